@@ -36,32 +36,24 @@
 
 #include "driver_amg8833_basic.h"
 
-static amg8833_handle_t gs_handle;        /**< amg8833 handle */
+static amg8833_handle_t gs_handle;          /**< amg8833 handle */
+static amg8833_acquire_t gs_acquire;        /**< amg8833 acquire */
 
 /**
  * @brief     basic example init
+ * @param[in] *handle pointer to an amg8833 handle structure
  * @param[in] addr_pin iic device address
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      the handle must be linked with the interface functions before calling
  */
-uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
+uint8_t amg8833_basic_handle_init(amg8833_handle_t *handle, amg8833_address_t addr_pin)
 {
     uint8_t res;
     
-    /* link interface function */
-    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
-    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, amg8833_interface_iic_init);
-    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, amg8833_interface_iic_deinit);
-    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, amg8833_interface_iic_read);
-    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, amg8833_interface_iic_write);
-    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
-    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
-    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, amg8833_interface_receive_callback);
-    
     /* set the address */
-    res = amg8833_set_addr_pin(&gs_handle, addr_pin);
+    res = amg8833_set_addr_pin(handle, addr_pin);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set addr pin failed.\n");
@@ -70,7 +62,7 @@ uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
     }
     
     /* init */
-    res = amg8833_init(&gs_handle);
+    res = amg8833_init(handle);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: init failed.\n");
@@ -79,41 +71,41 @@ uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
     }
     
     /* set normal mode */
-    res = amg8833_set_mode(&gs_handle, AMG8833_MODE_NORMAL);
+    res = amg8833_set_mode(handle, AMG8833_MODE_NORMAL);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set mode failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
    /* set frame rate */
-    res = amg8833_set_frame_rate(&gs_handle, AMG8833_BASIC_DEFAULT_FRAME_RATE);
+    res = amg8833_set_frame_rate(handle, AMG8833_BASIC_DEFAULT_FRAME_RATE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set frame rate failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
 
     /* disable */
-    res = amg8833_set_interrupt(&gs_handle, AMG8833_BOOL_FALSE);
+    res = amg8833_set_interrupt(handle, AMG8833_BOOL_FALSE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set interrupt failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* set average mode */
-    res = amg8833_set_average_mode(&gs_handle, AMG8833_BASIC_DEFAULT_AVERAGE_MODE);
+    res = amg8833_set_average_mode(handle, AMG8833_BASIC_DEFAULT_AVERAGE_MODE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set average mode failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
@@ -122,15 +114,16 @@ uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
 }
 
 /**
- * @brief  basic example deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     basic example deinit
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t amg8833_basic_deinit(void)
+uint8_t amg8833_basic_handle_deinit(amg8833_handle_t *handle)
 {
-    if (amg8833_deinit(&gs_handle) != 0)
+    if (amg8833_deinit(handle) != 0)
     {
         return 1;
     }
@@ -142,18 +135,19 @@ uint8_t amg8833_basic_deinit(void)
 
 /**
  * @brief      basic example read temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[out] **temp pointer to a temperature array
  * @return     status code
  *             - 0 success
  *             - 1 read temperature array failed
  * @note       none
  */
-uint8_t amg8833_basic_read_temperature_array(float temp[8][8])
+uint8_t amg8833_basic_handle_read_temperature_array(amg8833_handle_t *handle, float temp[8][8])
 {
     int16_t raw[8][8];
     
     /* read temperature array */
-    if (amg8833_read_temperature_array(&gs_handle, (int16_t (*)[8])raw, temp) != 0)
+    if (amg8833_read_temperature_array(handle, (int16_t (*)[8])raw, temp) != 0)
     {
         return 1;
     }
@@ -165,18 +159,183 @@ uint8_t amg8833_basic_read_temperature_array(float temp[8][8])
 
 /**
  * @brief      basic example read temperature
+ * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[out] *temp pointer to a temperature buffer
  * @return     status code
  *             - 0 success
  *             - 1 read temperature failed
  * @note       none
  */
-uint8_t amg8833_basic_read_temperature(float *temp)
+uint8_t amg8833_basic_handle_read_temperature(amg8833_handle_t *handle, float *temp)
 {
     int16_t raw;
     
     /* read temperature */
-    if (amg8833_read_temperature(&gs_handle, (int16_t *)&raw, (float *)temp) != 0)
+    if (amg8833_read_temperature(handle, (int16_t *)&raw, (float *)temp) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      basic example read the next new temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *acquire pointer to an initialized acquire structure
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_basic_handle_read_temperature_array_sync(amg8833_handle_t *handle, amg8833_acquire_t *acquire, float temp[8][8])
+{
+    uint8_t res;
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];
+    uint32_t next;
+    int32_t wait;
+    uint8_t i, j;
+    
+    /* read until a new frame lands */
+    while (1)
+    {
+        res = amg8833_acquire_read(handle, acquire, amg8833_interface_timestamp_us(), buf, &next);
+        if (res == 0)
+        {
+            break;
+        }
+        else if (res != 4)
+        {
+            return 1;
+        }
+        else
+        {
+            /* wait for the next read */
+            wait = (int32_t)(next - amg8833_interface_timestamp_us());
+            if (wait > 0)
+            {
+                amg8833_interface_delay_ms(((uint32_t)wait + 999) / 1000);
+            }
+        }
+    }
+    
+    /* convert */
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            temp[i][j] = (float)AMG8833_FRAME_PIXEL_AT(buf, i, j) * 0.25f;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example init
+ * @param[in] addr_pin iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
+{
+    /* link interface function */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, amg8833_interface_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, amg8833_interface_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, amg8833_interface_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, amg8833_interface_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, amg8833_interface_receive_callback);
+    
+    /* basic init */
+    if (amg8833_basic_handle_init(&gs_handle, addr_pin) != 0)
+    {
+        return 1;
+    }
+    
+    /* init the frame acquisition */
+    if (amg8833_acquire_init(&gs_handle, &gs_acquire) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: acquire init failed.\n");
+        (void)amg8833_basic_handle_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  basic example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t amg8833_basic_deinit(void)
+{
+    return amg8833_basic_handle_deinit(&gs_handle);
+}
+
+/**
+ * @brief      basic example read temperature array
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_basic_read_temperature_array(float temp[8][8])
+{
+    return amg8833_basic_handle_read_temperature_array(&gs_handle, temp);
+}
+
+/**
+ * @brief      basic example read temperature
+ * @param[out] *temp pointer to a temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ * @note       none
+ */
+uint8_t amg8833_basic_read_temperature(float *temp)
+{
+    return amg8833_basic_handle_read_temperature(&gs_handle, temp);
+}
+
+/**
+ * @brief      basic example read the next new temperature array
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_basic_read_temperature_array_sync(float temp[8][8])
+{
+    return amg8833_basic_handle_read_temperature_array_sync(&gs_handle, &gs_acquire, temp);
+}
+
+/**
+ * @brief      basic example get the acquisition statistics
+ * @param[out] *frames pointer to a new frame number buffer
+ * @param[out] *duplicates pointer to a duplicate read number buffer
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
+ * @note       none
+ */
+uint8_t amg8833_basic_get_statistics(uint32_t *frames, uint32_t *duplicates, uint32_t *dropped)
+{
+    if (amg8833_acquire_get_statistics(&gs_handle, &gs_acquire, frames, duplicates, dropped) != 0)
     {
         return 1;
     }
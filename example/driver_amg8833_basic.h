@@ -56,6 +56,61 @@ extern "C"{
 #define AMG8833_BASIC_DEFAULT_FRAME_RATE          AMG8833_FRAME_RATE_10_FPS        /**< 10 fps */
 #define AMG8833_BASIC_DEFAULT_AVERAGE_MODE        AMG8833_AVERAGE_MODE_TWICE       /**< twice */
 
+/**
+ * @brief     basic example init
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] addr_pin iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the handle must be linked with the interface functions before calling
+ */
+uint8_t amg8833_basic_handle_init(amg8833_handle_t *handle, amg8833_address_t addr_pin);
+
+/**
+ * @brief     basic example deinit
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t amg8833_basic_handle_deinit(amg8833_handle_t *handle);
+
+/**
+ * @brief      basic example read temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_basic_handle_read_temperature_array(amg8833_handle_t *handle, float temp[8][8]);
+
+/**
+ * @brief      basic example read temperature
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *temp pointer to a temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ * @note       none
+ */
+uint8_t amg8833_basic_handle_read_temperature(amg8833_handle_t *handle, float *temp);
+
+/**
+ * @brief      basic example read the next new temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *acquire pointer to an initialized acquire structure
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       it waits until a new frame lands, the array is in the identity orientation
+ */
+uint8_t amg8833_basic_handle_read_temperature_array_sync(amg8833_handle_t *handle, amg8833_acquire_t *acquire, float temp[8][8]);
+
 /**
  * @brief     basic example init
  * @param[in] addr_pin iic device address
@@ -95,6 +150,28 @@ uint8_t amg8833_basic_read_temperature_array(float temp[8][8]);
  */
 uint8_t amg8833_basic_read_temperature(float *temp);
 
+/**
+ * @brief      basic example read the next new temperature array
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       it waits until a new frame lands
+ */
+uint8_t amg8833_basic_read_temperature_array_sync(float temp[8][8]);
+
+/**
+ * @brief      basic example get the acquisition statistics
+ * @param[out] *frames pointer to a new frame number buffer
+ * @param[out] *duplicates pointer to a duplicate read number buffer
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
+ * @note       none
+ */
+uint8_t amg8833_basic_get_statistics(uint32_t *frames, uint32_t *duplicates, uint32_t *dropped);
+
 /**
  * @}
  */
@@ -36,18 +36,20 @@
 
 #include "driver_amg8833_interrupt.h"
 
-static amg8833_handle_t gs_handle;        /**< amg8833 handle */
+static amg8833_handle_t gs_handle;                       /**< amg8833 handle */
+static void (*gs_receive_callback)(uint8_t type);        /**< receive callback */
 
 /**
- * @brief  interrupt irq callback
- * @return status code
- *         - 0 success
- *         - 1 run failed
- * @note   none
+ * @brief     interrupt irq callback
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
  */
-uint8_t amg8833_interrupt_irq_handler(void)
+uint8_t amg8833_interrupt_handle_irq_handler(amg8833_handle_t *handle)
 {
-    if (amg8833_irq_handler(&gs_handle) != 0)
+    if (amg8833_irq_handler(handle) != 0)
     {
         return 1;
     }
@@ -59,39 +61,38 @@ uint8_t amg8833_interrupt_irq_handler(void)
 
 /**
  * @brief     interrupt example init
+ * @param[in] *handle pointer to an amg8833 handle structure
  * @param[in] addr_pin iic device address
  * @param[in] mode interrupt mode
  * @param[in] high_level high level
  * @param[in] low_level low level
  * @param[in] hysteresis_level hysteresis level
- * @param[in] *callback pointer to a callback function
+ * @param[in] *callback pointer to a callback function with the user context
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      the handle must be linked with the interface functions except
+ *            the receive callback before calling, the callback is linked with
+ *            DRIVER_AMG8833_LINK_RECEIVE_CALLBACK_CTX and gets the user context of the handle
  */
-uint8_t amg8833_interrupt_init(amg8833_address_t addr_pin,
-                               amg8833_interrupt_mode_t mode,
-                               float high_level, float low_level, 
-                               float hysteresis_level,
-                               void (*callback)(uint8_t type) 
-                              )
+uint8_t amg8833_interrupt_handle_init(amg8833_handle_t *handle,
+                                      amg8833_address_t addr_pin,
+                                      amg8833_interrupt_mode_t mode,
+                                      float high_level, float low_level, 
+                                      float hysteresis_level,
+                                      void (*callback)(void *user, uint8_t type) 
+                                     )
 {
     uint8_t res;
-    int16_t level;
+    int16_t high;
+    int16_t low;
+    int16_t hysteresis;
     
-    /* link interface function */
-    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
-    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, amg8833_interface_iic_init);
-    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, amg8833_interface_iic_deinit);
-    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, amg8833_interface_iic_read);
-    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, amg8833_interface_iic_write);
-    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
-    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
-    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, callback);
+    /* link callback function */
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK_CTX(handle, callback);
     
     /* set the address */
-    res = amg8833_set_addr_pin(&gs_handle, addr_pin);
+    res = amg8833_set_addr_pin(handle, addr_pin);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set addr pin failed.\n");
@@ -100,7 +101,7 @@ uint8_t amg8833_interrupt_init(amg8833_address_t addr_pin,
     }
     
     /* init */
-    res = amg8833_init(&gs_handle);
+    res = amg8833_init(handle);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: init failed.\n");
@@ -109,122 +110,102 @@ uint8_t amg8833_interrupt_init(amg8833_address_t addr_pin,
     }
     
     /* set normal mode */
-    res = amg8833_set_mode(&gs_handle, AMG8833_MODE_NORMAL);
+    res = amg8833_set_mode(handle, AMG8833_MODE_NORMAL);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set mode failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* set frame rate */
-    res = amg8833_set_frame_rate(&gs_handle, AMG8833_INTERRUPT_DEFAULT_FRAME_RATE);
+    res = amg8833_set_frame_rate(handle, AMG8833_INTERRUPT_DEFAULT_FRAME_RATE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set frame rate failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* set average mode */
-    res = amg8833_set_average_mode(&gs_handle, AMG8833_INTERRUPT_DEFAULT_AVERAGE_MODE);
+    res = amg8833_set_average_mode(handle, AMG8833_INTERRUPT_DEFAULT_AVERAGE_MODE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set average mode failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     
     /* convert */
-    res = amg8833_interrupt_level_convert_to_register(&gs_handle, high_level, (int16_t *)&level);
+    res = amg8833_interrupt_level_convert_to_register(handle, high_level, (int16_t *)&high);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: interrupt level convert to register failed.\n");
-        (void)amg8833_deinit(&gs_handle);
-       
-        return 1;
-    }
-    
-    /* high level */
-    res = amg8833_set_interrupt_high_level(&gs_handle, level);
-    if (res != 0)
-    {
-        amg8833_interface_debug_print("amg8833: set interrupt high level failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* convert */
-    res = amg8833_interrupt_level_convert_to_register(&gs_handle, low_level, (int16_t *)&level);
+    res = amg8833_interrupt_level_convert_to_register(handle, low_level, (int16_t *)&low);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: interrupt level convert to register failed.\n");
-        (void)amg8833_deinit(&gs_handle);
-       
-        return 1;
-    }
-    
-    /* low level */
-    res = amg8833_set_interrupt_low_level(&gs_handle, level);
-    if (res != 0)
-    {
-        amg8833_interface_debug_print("amg8833: set interrupt low level failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* convert */
-    res = amg8833_interrupt_level_convert_to_register(&gs_handle, hysteresis_level, (int16_t *)&level);
+    res = amg8833_interrupt_level_convert_to_register(handle, hysteresis_level, (int16_t *)&hysteresis);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: interrupt level convert to register failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
-    /* hysteresis level */
-    res = amg8833_set_interrupt_hysteresis_level(&gs_handle, level);
+    /* set high, low and hysteresis level */
+    res = amg8833_set_interrupt_levels(handle, high, low, hysteresis);
     if (res != 0)
     {
-        amg8833_interface_debug_print("amg8833: set interrupt hysteresis level failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        amg8833_interface_debug_print("amg8833: set interrupt levels failed.\n");
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* set mode */
-    res = amg8833_set_interrupt_mode(&gs_handle, mode);
+    res = amg8833_set_interrupt_mode(handle, mode);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set interrupt mode failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* flag reset */
-    res = amg8833_reset(&gs_handle, AMG8833_RESET_TYPE_FLAG);
+    res = amg8833_reset(handle, AMG8833_RESET_TYPE_FLAG);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: reset failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
     
     /* enable */
-    res = amg8833_set_interrupt(&gs_handle, AMG8833_BOOL_TRUE);
+    res = amg8833_set_interrupt(handle, AMG8833_BOOL_TRUE);
     if (res != 0)
     {
         amg8833_interface_debug_print("amg8833: set interrupt failed.\n");
-        (void)amg8833_deinit(&gs_handle);
+        (void)amg8833_deinit(handle);
        
         return 1;
     }
@@ -233,15 +214,16 @@ uint8_t amg8833_interrupt_init(amg8833_address_t addr_pin,
 }
 
 /**
- * @brief  interrupt example deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     interrupt example deinit
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t amg8833_interrupt_deinit(void)
+uint8_t amg8833_interrupt_handle_deinit(amg8833_handle_t *handle)
 {
-    if (amg8833_deinit(&gs_handle) != 0)
+    if (amg8833_deinit(handle) != 0)
     {
         return 1;
     }
@@ -253,16 +235,17 @@ uint8_t amg8833_interrupt_deinit(void)
 
 /**
  * @brief      interrupt example get interrupt table
+ * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[out] **table pointer to a table buffer
  * @return     status code
  *             - 0 success
  *             - 1 get interrupt table failed
  * @note       none
  */
-uint8_t amg8833_interrupt_get_table(uint8_t table[8][1])
+uint8_t amg8833_interrupt_handle_get_table(amg8833_handle_t *handle, uint8_t table[8][1])
 {
     /* get interrupt table */
-    if (amg8833_get_interrupt_table(&gs_handle, table) != 0)
+    if (amg8833_get_interrupt_table(handle, table) != 0)
     {
         return 1;
     }
@@ -274,18 +257,19 @@ uint8_t amg8833_interrupt_get_table(uint8_t table[8][1])
 
 /**
  * @brief      interrupt example read temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[out] **temp pointer to a temperature array
  * @return     status code
  *             - 0 success
  *             - 1 read temperature array failed
  * @note       none
  */
-uint8_t amg8833_interrupt_read_temperature_array(float temp[8][8])
+uint8_t amg8833_interrupt_handle_read_temperature_array(amg8833_handle_t *handle, float temp[8][8])
 {
     int16_t raw[8][8];
     
     /* read temperature array */
-    if (amg8833_read_temperature_array(&gs_handle, (int16_t (*)[8])raw, temp) != 0)
+    if (amg8833_read_temperature_array(handle, (int16_t (*)[8])raw, temp) != 0)
     {
         return 1;
     }
@@ -297,18 +281,19 @@ uint8_t amg8833_interrupt_read_temperature_array(float temp[8][8])
 
 /**
  * @brief      interrupt example read temperature
+ * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[out] *temp pointer to a temperature buffer
  * @return     status code
  *             - 0 success
  *             - 1 read temperature failed
  * @note       none
  */
-uint8_t amg8833_interrupt_read_temperature(float *temp)
+uint8_t amg8833_interrupt_handle_read_temperature(amg8833_handle_t *handle, float *temp)
 {
     int16_t raw;
     
     /* read temperature */
-    if (amg8833_read_temperature(&gs_handle, (int16_t *)&raw, (float *)temp) != 0)
+    if (amg8833_read_temperature(handle, (int16_t *)&raw, (float *)temp) != 0)
     {
         return 1;
     }
@@ -317,3 +302,116 @@ uint8_t amg8833_interrupt_read_temperature(float *temp)
         return 0;
     }
 }
+
+/**
+ * @brief  interrupt irq callback
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+uint8_t amg8833_interrupt_irq_handler(void)
+{
+    return amg8833_interrupt_handle_irq_handler(&gs_handle);
+}
+
+/**
+ * @brief     interrupt receive callback
+ * @param[in] *user pointer to a user context
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_amg8833_interrupt_receive_callback(void *user, uint8_t type)
+{
+    (void)user;
+    
+    if (gs_receive_callback != NULL)
+    {
+        gs_receive_callback(type);
+    }
+}
+
+/**
+ * @brief     interrupt example init
+ * @param[in] addr_pin iic device address
+ * @param[in] mode interrupt mode
+ * @param[in] high_level high level
+ * @param[in] low_level low level
+ * @param[in] hysteresis_level hysteresis level
+ * @param[in] *callback pointer to a callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t amg8833_interrupt_init(amg8833_address_t addr_pin,
+                               amg8833_interrupt_mode_t mode,
+                               float high_level, float low_level, 
+                               float hysteresis_level,
+                               void (*callback)(uint8_t type) 
+                              )
+{
+    /* link interface function */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, amg8833_interface_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, amg8833_interface_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, amg8833_interface_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, amg8833_interface_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    gs_receive_callback = callback;
+    
+    return amg8833_interrupt_handle_init(&gs_handle, addr_pin, mode, high_level, low_level, hysteresis_level,
+                                         a_amg8833_interrupt_receive_callback);
+}
+
+/**
+ * @brief  interrupt example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t amg8833_interrupt_deinit(void)
+{
+    return amg8833_interrupt_handle_deinit(&gs_handle);
+}
+
+/**
+ * @brief      interrupt example get interrupt table
+ * @param[out] **table pointer to a table buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt table failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_get_table(uint8_t table[8][1])
+{
+    return amg8833_interrupt_handle_get_table(&gs_handle, table);
+}
+
+/**
+ * @brief      interrupt example read temperature array
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_read_temperature_array(float temp[8][8])
+{
+    return amg8833_interrupt_handle_read_temperature_array(&gs_handle, temp);
+}
+
+/**
+ * @brief      interrupt example read temperature
+ * @param[out] *temp pointer to a temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_read_temperature(float *temp)
+{
+    return amg8833_interrupt_handle_read_temperature(&gs_handle, temp);
+}
@@ -55,6 +55,83 @@ extern "C"{
 #define AMG8833_INTERRUPT_DEFAULT_FRAME_RATE          AMG8833_FRAME_RATE_1_FPS         /**< 1 fps */
 #define AMG8833_INTERRUPT_DEFAULT_AVERAGE_MODE        AMG8833_AVERAGE_MODE_TWICE       /**< twice */
 
+/**
+ * @brief     interrupt irq callback
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t amg8833_interrupt_handle_irq_handler(amg8833_handle_t *handle);
+
+/**
+ * @brief     interrupt example init
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] addr_pin iic device address
+ * @param[in] mode interrupt mode
+ * @param[in] high_level high level
+ * @param[in] low_level low level
+ * @param[in] hysteresis_level hysteresis level
+ * @param[in] *callback pointer to a callback function with the user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the handle must be linked with the interface functions except
+ *            the receive callback before calling, the callback is linked with
+ *            DRIVER_AMG8833_LINK_RECEIVE_CALLBACK_CTX and gets the user context of the handle
+ */
+uint8_t amg8833_interrupt_handle_init(amg8833_handle_t *handle,
+                                      amg8833_address_t addr_pin,
+                                      amg8833_interrupt_mode_t mode,
+                                      float high_level, float low_level, 
+                                      float hysteresis_level,
+                                      void (*callback)(void *user, uint8_t type) 
+                                     );
+
+/**
+ * @brief     interrupt example deinit
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t amg8833_interrupt_handle_deinit(amg8833_handle_t *handle);
+
+/**
+ * @brief      interrupt example get interrupt table
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **table pointer to a table buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt table failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_handle_get_table(amg8833_handle_t *handle, uint8_t table[8][1]);
+
+/**
+ * @brief      interrupt example read temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **temp pointer to a temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_handle_read_temperature_array(amg8833_handle_t *handle, float temp[8][8]);
+
+/**
+ * @brief      interrupt example read temperature
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *temp pointer to a temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_handle_read_temperature(amg8833_handle_t *handle, float *temp);
+
 /**
  * @brief  interrupt irq callback
  * @return status code
@@ -101,6 +101,13 @@ uint8_t amg8833_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
  */
 void amg8833_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface get the timestamp in us
+ * @return timestamp
+ * @note   the timestamp wraps around
+ */
+uint32_t amg8833_interface_timestamp_us(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -115,6 +122,62 @@ void amg8833_interface_debug_print(const char *const fmt, ...);
  */
 void amg8833_interface_receive_callback(uint8_t type);
 
+/**
+ * @brief     interface iic bus init with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_init_ctx(void *user);
+
+/**
+ * @brief     interface iic bus deinit with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_deinit_ctx(void *user);
+
+/**
+ * @brief      interface iic bus read with the user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     interface iic bus write with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     interface receive callback with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] type interrupt type
+ * @note      none
+ */
+void amg8833_interface_receive_callback_ctx(void *user, uint8_t type);
+
 /**
  * @}
  */
@@ -0,0 +1,770 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     benchmark main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833.h"
+#include "raspberrypi4b_driver_amg8833_simulator.h"
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief benchmark calibration definition
+ */
+#define AMG8833_BENCHMARK_CALIBRATE_TIMES    100000        /**< empty calls of the overhead calibration */
+
+/**
+ * @brief benchmark api structure definition
+ */
+typedef struct amg8833_benchmark_api_s
+{
+    const char *name;              /**< api name */
+    void (*prepare)(void);         /**< untimed setup before every call */
+    uint8_t (*run)(void);          /**< timed call */
+} amg8833_benchmark_api_t;
+
+static amg8833_simulator_t gs_simulator;              /**< simulated sensor */
+static amg8833_handle_t gs_handle;                    /**< amg8833 handle */
+static amg8833_acquire_t gs_acquire;                  /**< acquire context */
+static amg8833_snapshot_t gs_snapshot;                /**< snapshot buffer */
+static amg8833_info_t gs_info;                        /**< info buffer */
+static int16_t gs_raw[8][8];                          /**< raw buffer */
+static float gs_temp[8][8];                           /**< temperature buffer */
+static int32_t gs_fixed[8][8];                        /**< fixed point buffer */
+static uint8_t gs_buf[AMG8833_FRAME_BUFFER_SIZE];     /**< frame buffer */
+static uint8_t gs_table[8][1];                        /**< interrupt table buffer */
+static uint64_t gs_mask;                              /**< interrupt mask buffer */
+static uint8_t gs_status;                             /**< status buffer */
+static uint32_t gs_next;                              /**< next read timestamp */
+
+/**
+ * @brief     benchmark delay ms
+ * @param[in] ms time
+ * @note      the simulated time advances without waiting
+ */
+static void a_benchmark_delay_ms(uint32_t ms)
+{
+    (void)amg8833_simulator_advance(&gs_simulator, ms * 1000);
+}
+
+/**
+ * @brief     benchmark print format data
+ * @param[in] fmt format data
+ * @note      the driver messages go to stderr and keep stdout valid json
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     benchmark receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_benchmark_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief benchmark prepare functions
+ */
+static void a_benchmark_prepare_init(void)
+{
+    (void)amg8833_deinit(&gs_handle);
+}
+
+static void a_benchmark_prepare_deinit(void)
+{
+    (void)amg8833_init(&gs_handle);
+}
+
+static void a_benchmark_prepare_irq(void)
+{
+    gs_simulator.reg[0x04] |= (1 << 1);
+}
+
+static void a_benchmark_prepare_frame(void)
+{
+    int32_t wait;
+    
+    wait = (int32_t)(gs_next - (uint32_t)gs_simulator.now);
+    (void)amg8833_simulator_advance(&gs_simulator, (wait > 0) ? (uint32_t)wait : 0);
+}
+
+/**
+ * @brief benchmark run functions
+ */
+static uint8_t a_benchmark_empty(void)
+{
+    return 0;
+}
+
+static uint8_t a_benchmark_info(void)
+{
+    return amg8833_info(&gs_info);
+}
+
+static uint8_t a_benchmark_irq_handler(void)
+{
+    return amg8833_irq_handler(&gs_handle);
+}
+
+static uint8_t a_benchmark_set_addr_pin(void)
+{
+    return amg8833_set_addr_pin(&gs_handle, AMG8833_ADDRESS_0);
+}
+
+static uint8_t a_benchmark_get_addr_pin(void)
+{
+    amg8833_address_t addr_pin;
+    
+    return amg8833_get_addr_pin(&gs_handle, &addr_pin);
+}
+
+static uint8_t a_benchmark_set_orientation(void)
+{
+    return amg8833_set_orientation(&gs_handle, AMG8833_ORIENTATION_IDENTITY);
+}
+
+static uint8_t a_benchmark_get_orientation(void)
+{
+    amg8833_orientation_t orientation;
+    
+    return amg8833_get_orientation(&gs_handle, &orientation);
+}
+
+static uint8_t a_benchmark_set_register_cache(void)
+{
+    return amg8833_set_register_cache(&gs_handle, (amg8833_bool_t)gs_handle.cache_enable);
+}
+
+static uint8_t a_benchmark_get_register_cache(void)
+{
+    amg8833_bool_t enable;
+    
+    return amg8833_get_register_cache(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_set_frame_change_detect(void)
+{
+    return amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_FALSE);
+}
+
+static uint8_t a_benchmark_get_frame_change_detect(void)
+{
+    amg8833_bool_t enable;
+    
+    return amg8833_get_frame_change_detect(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_init(void)
+{
+    return amg8833_init(&gs_handle);
+}
+
+static uint8_t a_benchmark_deinit(void)
+{
+    return amg8833_deinit(&gs_handle);
+}
+
+static uint8_t a_benchmark_read_temperature(void)
+{
+    int16_t raw;
+    float temp;
+    
+    return amg8833_read_temperature(&gs_handle, &raw, &temp);
+}
+
+static uint8_t a_benchmark_read_temperature_array(void)
+{
+    return amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+}
+
+static uint8_t a_benchmark_read_temperature_array_raw(void)
+{
+    return amg8833_read_temperature_array_raw(&gs_handle, gs_raw);
+}
+
+static uint8_t a_benchmark_read_temperature_array_fixed(void)
+{
+    return amg8833_read_temperature_array_fixed(&gs_handle, AMG8833_FIXED_POINT_CENTI, gs_fixed);
+}
+
+static uint8_t a_benchmark_read_temperature_array_buffer(void)
+{
+    return amg8833_read_temperature_array_buffer(&gs_handle, gs_buf);
+}
+
+static uint8_t a_benchmark_read_snapshot(void)
+{
+    return amg8833_read_snapshot(&gs_handle, &gs_snapshot);
+}
+
+static uint8_t a_benchmark_acquire_init(void)
+{
+    return amg8833_acquire_init(&gs_handle, &gs_acquire);
+}
+
+static uint8_t a_benchmark_acquire_read(void)
+{
+    uint8_t res;
+    
+    /* a duplicate frame is not ready and still a valid call */
+    res = amg8833_acquire_read(&gs_handle, &gs_acquire, (uint32_t)gs_simulator.now, gs_buf, &gs_next);
+    
+    return (res == 4) ? 0 : res;
+}
+
+static uint8_t a_benchmark_acquire_get_statistics(void)
+{
+    uint32_t frames, duplicates, dropped;
+    
+    return amg8833_acquire_get_statistics(&gs_handle, &gs_acquire, &frames, &duplicates, &dropped);
+}
+
+static uint8_t a_benchmark_get_interrupt_table(void)
+{
+    return amg8833_get_interrupt_table(&gs_handle, gs_table);
+}
+
+static uint8_t a_benchmark_get_interrupt_mask(void)
+{
+    return amg8833_get_interrupt_mask(&gs_handle, &gs_mask);
+}
+
+static uint8_t a_benchmark_set_mode(void)
+{
+    return amg8833_set_mode(&gs_handle, AMG8833_MODE_NORMAL);
+}
+
+static uint8_t a_benchmark_get_mode(void)
+{
+    amg8833_mode_t mode;
+    
+    return amg8833_get_mode(&gs_handle, &mode);
+}
+
+static uint8_t a_benchmark_reset(void)
+{
+    return amg8833_reset(&gs_handle, AMG8833_RESET_TYPE_FLAG);
+}
+
+static uint8_t a_benchmark_set_frame_rate(void)
+{
+    return amg8833_set_frame_rate(&gs_handle, AMG8833_FRAME_RATE_10_FPS);
+}
+
+static uint8_t a_benchmark_get_frame_rate(void)
+{
+    amg8833_frame_rate_t rate;
+    
+    return amg8833_get_frame_rate(&gs_handle, &rate);
+}
+
+static uint8_t a_benchmark_set_interrupt_mode(void)
+{
+    return amg8833_set_interrupt_mode(&gs_handle, AMG8833_INTERRUPT_MODE_ABSOLUTE);
+}
+
+static uint8_t a_benchmark_get_interrupt_mode(void)
+{
+    amg8833_interrupt_mode_t mode;
+    
+    return amg8833_get_interrupt_mode(&gs_handle, &mode);
+}
+
+static uint8_t a_benchmark_set_interrupt(void)
+{
+    return amg8833_set_interrupt(&gs_handle, AMG8833_BOOL_FALSE);
+}
+
+static uint8_t a_benchmark_get_interrupt(void)
+{
+    amg8833_bool_t enable;
+    
+    return amg8833_get_interrupt(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_get_status(void)
+{
+    return amg8833_get_status(&gs_handle, &gs_status);
+}
+
+static uint8_t a_benchmark_clear_status(void)
+{
+    return amg8833_clear_status(&gs_handle, AMG8833_STATUS_INTF);
+}
+
+static uint8_t a_benchmark_set_average_mode(void)
+{
+    return amg8833_set_average_mode(&gs_handle, AMG8833_AVERAGE_MODE_ONCE);
+}
+
+static uint8_t a_benchmark_get_average_mode(void)
+{
+    amg8833_average_mode_t mode;
+    
+    return amg8833_get_average_mode(&gs_handle, &mode);
+}
+
+static uint8_t a_benchmark_set_interrupt_high_level(void)
+{
+    return amg8833_set_interrupt_high_level(&gs_handle, 120);
+}
+
+static uint8_t a_benchmark_get_interrupt_high_level(void)
+{
+    int16_t level;
+    
+    return amg8833_get_interrupt_high_level(&gs_handle, &level);
+}
+
+static uint8_t a_benchmark_set_interrupt_low_level(void)
+{
+    return amg8833_set_interrupt_low_level(&gs_handle, 100);
+}
+
+static uint8_t a_benchmark_get_interrupt_low_level(void)
+{
+    int16_t level;
+    
+    return amg8833_get_interrupt_low_level(&gs_handle, &level);
+}
+
+static uint8_t a_benchmark_set_interrupt_hysteresis_level(void)
+{
+    return amg8833_set_interrupt_hysteresis_level(&gs_handle, 8);
+}
+
+static uint8_t a_benchmark_get_interrupt_hysteresis_level(void)
+{
+    int16_t level;
+    
+    return amg8833_get_interrupt_hysteresis_level(&gs_handle, &level);
+}
+
+static uint8_t a_benchmark_set_interrupt_levels(void)
+{
+    return amg8833_set_interrupt_levels(&gs_handle, 120, 100, 8);
+}
+
+static uint8_t a_benchmark_get_interrupt_levels(void)
+{
+    int16_t high, low, hysteresis;
+    
+    return amg8833_get_interrupt_levels(&gs_handle, &high, &low, &hysteresis);
+}
+
+static uint8_t a_benchmark_interrupt_level_convert_to_register(void)
+{
+    int16_t reg;
+    
+    return amg8833_interrupt_level_convert_to_register(&gs_handle, 30.0f, &reg);
+}
+
+static uint8_t a_benchmark_interrupt_level_convert_to_data(void)
+{
+    float temp;
+    
+    return amg8833_interrupt_level_convert_to_data(&gs_handle, 120, &temp);
+}
+
+static uint8_t a_benchmark_set_reg(void)
+{
+    uint8_t buf[1] = {AMG8833_MODE_NORMAL};
+    
+    return amg8833_set_reg(&gs_handle, 0x00, buf, 1);
+}
+
+static uint8_t a_benchmark_get_reg(void)
+{
+    uint8_t buf[1];
+    
+    return amg8833_get_reg(&gs_handle, 0x00, buf, 1);
+}
+
+/**
+ * @brief benchmark api table, every public api of driver_amg8833.h
+ * @note  deinit leaves the sensor asleep and the bus closed, so it runs last
+ */
+static const amg8833_benchmark_api_t gs_api[] =
+{
+    {"amg8833_info", NULL, a_benchmark_info},
+    {"amg8833_init", a_benchmark_prepare_init, a_benchmark_init},
+    {"amg8833_irq_handler", a_benchmark_prepare_irq, a_benchmark_irq_handler},
+    {"amg8833_set_addr_pin", NULL, a_benchmark_set_addr_pin},
+    {"amg8833_get_addr_pin", NULL, a_benchmark_get_addr_pin},
+    {"amg8833_set_orientation", NULL, a_benchmark_set_orientation},
+    {"amg8833_get_orientation", NULL, a_benchmark_get_orientation},
+    {"amg8833_set_register_cache", NULL, a_benchmark_set_register_cache},
+    {"amg8833_get_register_cache", NULL, a_benchmark_get_register_cache},
+    {"amg8833_set_frame_change_detect", NULL, a_benchmark_set_frame_change_detect},
+    {"amg8833_get_frame_change_detect", NULL, a_benchmark_get_frame_change_detect},
+    {"amg8833_read_temperature", NULL, a_benchmark_read_temperature},
+    {"amg8833_read_temperature_array", NULL, a_benchmark_read_temperature_array},
+    {"amg8833_read_temperature_array_raw", NULL, a_benchmark_read_temperature_array_raw},
+    {"amg8833_read_temperature_array_fixed", NULL, a_benchmark_read_temperature_array_fixed},
+    {"amg8833_read_temperature_array_buffer", NULL, a_benchmark_read_temperature_array_buffer},
+    {"amg8833_read_snapshot", NULL, a_benchmark_read_snapshot},
+    {"amg8833_acquire_init", NULL, a_benchmark_acquire_init},
+    {"amg8833_acquire_read", a_benchmark_prepare_frame, a_benchmark_acquire_read},
+    {"amg8833_acquire_get_statistics", NULL, a_benchmark_acquire_get_statistics},
+    {"amg8833_get_interrupt_table", NULL, a_benchmark_get_interrupt_table},
+    {"amg8833_get_interrupt_mask", NULL, a_benchmark_get_interrupt_mask},
+    {"amg8833_set_mode", NULL, a_benchmark_set_mode},
+    {"amg8833_get_mode", NULL, a_benchmark_get_mode},
+    {"amg8833_reset", NULL, a_benchmark_reset},
+    {"amg8833_set_frame_rate", NULL, a_benchmark_set_frame_rate},
+    {"amg8833_get_frame_rate", NULL, a_benchmark_get_frame_rate},
+    {"amg8833_set_interrupt_mode", NULL, a_benchmark_set_interrupt_mode},
+    {"amg8833_get_interrupt_mode", NULL, a_benchmark_get_interrupt_mode},
+    {"amg8833_set_interrupt", NULL, a_benchmark_set_interrupt},
+    {"amg8833_get_interrupt", NULL, a_benchmark_get_interrupt},
+    {"amg8833_get_status", NULL, a_benchmark_get_status},
+    {"amg8833_clear_status", NULL, a_benchmark_clear_status},
+    {"amg8833_set_average_mode", NULL, a_benchmark_set_average_mode},
+    {"amg8833_get_average_mode", NULL, a_benchmark_get_average_mode},
+    {"amg8833_set_interrupt_high_level", NULL, a_benchmark_set_interrupt_high_level},
+    {"amg8833_get_interrupt_high_level", NULL, a_benchmark_get_interrupt_high_level},
+    {"amg8833_set_interrupt_low_level", NULL, a_benchmark_set_interrupt_low_level},
+    {"amg8833_get_interrupt_low_level", NULL, a_benchmark_get_interrupt_low_level},
+    {"amg8833_set_interrupt_hysteresis_level", NULL, a_benchmark_set_interrupt_hysteresis_level},
+    {"amg8833_get_interrupt_hysteresis_level", NULL, a_benchmark_get_interrupt_hysteresis_level},
+    {"amg8833_set_interrupt_levels", NULL, a_benchmark_set_interrupt_levels},
+    {"amg8833_get_interrupt_levels", NULL, a_benchmark_get_interrupt_levels},
+    {"amg8833_interrupt_level_convert_to_register", NULL, a_benchmark_interrupt_level_convert_to_register},
+    {"amg8833_interrupt_level_convert_to_data", NULL, a_benchmark_interrupt_level_convert_to_data},
+    {"amg8833_set_reg", NULL, a_benchmark_set_reg},
+    {"amg8833_get_reg", NULL, a_benchmark_get_reg},
+    {"amg8833_deinit", a_benchmark_prepare_deinit, a_benchmark_deinit},
+};
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      run an api
+ * @param[in]  *api pointer to a benchmark api structure
+ * @param[in]  times call times
+ * @param[in]  overhead timing overhead in ns
+ * @param[out] *res pointer to a result buffer, reads, writes, bytes, mean ns and min ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       every call is timed alone and the bus statistics exclude the prepare function
+ */
+static uint8_t a_benchmark_run(const amg8833_benchmark_api_t *api, uint32_t times, double overhead, double res[5])
+{
+    uint32_t i;
+    uint32_t reads, writes;
+    uint64_t read_bytes, write_bytes;
+    uint32_t reads_total, writes_total;
+    uint64_t bytes_total;
+    uint64_t total, min;
+    uint64_t t0, t1;
+    
+    reads_total = 0;
+    writes_total = 0;
+    bytes_total = 0;
+    total = 0;
+    min = UINT64_MAX;
+    for (i = 0; i < times; i++)
+    {
+        if (api->prepare != NULL)
+        {
+            api->prepare();
+        }
+        (void)amg8833_simulator_clear_statistics(&gs_simulator);
+        t0 = a_benchmark_ns();
+        if (api->run() != 0)
+        {
+            return 1;
+        }
+        t1 = a_benchmark_ns();
+        (void)amg8833_simulator_get_statistics(&gs_simulator, &reads, &writes, &read_bytes, &write_bytes);
+        reads_total += reads;
+        writes_total += writes;
+        bytes_total += read_bytes + write_bytes;
+        total += t1 - t0;
+        if (t1 - t0 < min)
+        {
+            min = t1 - t0;
+        }
+    }
+    res[0] = (double)reads_total / times;
+    res[1] = (double)writes_total / times;
+    res[2] = (double)bytes_total / times;
+    res[3] = (double)total / times - overhead;
+    res[4] = (double)min - overhead;
+    res[3] = (res[3] < 0.0) ? 0.0 : res[3];
+    res[4] = (res[4] < 0.0) ? 0.0 : res[4];
+    
+    return 0;
+}
+
+/**
+ * @brief     amg8833 benchmark function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the json results go to stdout or the file
+ */
+uint8_t amg8833_benchmark(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"file", required_argument, NULL, 1},
+        {"times", required_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+    uint32_t times = 10000;
+    char file_name[256] = {0};
+    amg8833_benchmark_api_t empty = {"empty", NULL, a_benchmark_empty};
+    double overhead;
+    double res[5];
+    FILE *fp;
+    uint32_t i, j;
+    uint8_t cache;
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                goto help;
+            }
+            
+            /* file */
+            case 1 :
+            {
+                /* set the file */
+                memset(file_name, 0, sizeof(char) * 256);
+                snprintf(file_name, 256, "%s", optarg);
+                
+                break;
+            }
+            
+            /* running times */
+            case 2 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                if (times == 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* link the simulated sensor */
+    (void)amg8833_simulator_init(&gs_simulator, 1);
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT_CTX(&gs_handle, amg8833_simulator_iic_init_ctx);
+    DRIVER_AMG8833_LINK_IIC_DEINIT_CTX(&gs_handle, amg8833_simulator_iic_deinit_ctx);
+    DRIVER_AMG8833_LINK_IIC_READ_CTX(&gs_handle, amg8833_simulator_iic_read_ctx);
+    DRIVER_AMG8833_LINK_IIC_WRITE_CTX(&gs_handle, amg8833_simulator_iic_write_ctx);
+    DRIVER_AMG8833_LINK_USER(&gs_handle, &gs_simulator);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_benchmark_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, a_benchmark_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_benchmark_receive_callback);
+    
+    /* open the output */
+    if (file_name[0] != 0)
+    {
+        fp = fopen(file_name, "w");
+        if (fp == NULL)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        fp = stdout;
+    }
+    
+    /* calibrate the timing overhead, independent of the times */
+    (void)a_benchmark_run(&empty, AMG8833_BENCHMARK_CALIBRATE_TIMES, 0.0, res);
+    overhead = res[4];
+    
+    (void)amg8833_info(&gs_info);
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"driver\": \"%s\",\n", gs_info.chip_name);
+    fprintf(fp, "  \"driver_version\": %u,\n", (unsigned int)gs_info.driver_version);
+    fprintf(fp, "  \"times\": %u,\n", (unsigned int)times);
+    fprintf(fp, "  \"overhead_ns\": %0.1f,\n", overhead);
+    fprintf(fp, "  \"results\": [\n");
+    for (cache = 0; cache < 2; cache++)
+    {
+        /* every api runs with and without the register cache */
+        (void)amg8833_set_register_cache(&gs_handle, (amg8833_bool_t)cache);
+        if (amg8833_init(&gs_handle) != 0)
+        {
+            goto failed;
+        }
+        if (amg8833_acquire_init(&gs_handle, &gs_acquire) != 0)
+        {
+            goto failed;
+        }
+        for (i = 0; i < sizeof(gs_api) / sizeof(gs_api[0]); i++)
+        {
+            if (a_benchmark_run(&gs_api[i], times, overhead, res) != 0)
+            {
+                a_benchmark_debug_print("amg8833: %s failed.\n", gs_api[i].name);
+                
+                goto failed;
+            }
+            fprintf(fp, "    {\"api\": \"%s\", \"cache\": %s, \"transactions\": %0.2f, \"reads\": %0.2f, "
+                    "\"writes\": %0.2f, \"bytes\": %0.2f, \"ns\": %0.1f, \"min_ns\": %0.1f}",
+                    gs_api[i].name, (cache != 0) ? "true" : "false", res[0] + res[1], res[0], res[1],
+                    res[2], res[3], res[4]);
+            j = (cache == 0) || (i + 1 < sizeof(gs_api) / sizeof(gs_api[0]));
+            fprintf(fp, "%s\n", (j != 0) ? "," : "");
+        }
+        (void)amg8833_deinit(&gs_handle);
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+    if (fp != stdout)
+    {
+        (void)fclose(fp);
+    }
+    
+    return 0;
+    
+    failed:
+    (void)amg8833_deinit(&gs_handle);
+    if (fp != stdout)
+    {
+        (void)fclose(fp);
+    }
+    
+    return 1;
+    
+    help:
+    a_benchmark_debug_print("Usage:\n");
+    a_benchmark_debug_print("  amg8833_benchmark (-h | --help)\n");
+    a_benchmark_debug_print("  amg8833_benchmark [--times=<num>] [--file=<path>]\n");
+    a_benchmark_debug_print("\n");
+    a_benchmark_debug_print("Options:\n");
+    a_benchmark_debug_print("      --file=<path>                      Write the json results to the file.([default: stdout])\n");
+    a_benchmark_debug_print("  -h, --help                             Show the help.\n");
+    a_benchmark_debug_print("      --times=<num>                      Set the calls of every api.([default: 10000])\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    uint8_t res;
+
+    res = amg8833_benchmark(argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        a_benchmark_debug_print("amg8833: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        a_benchmark_debug_print("amg8833: param is invalid.\n");
+    }
+    else
+    {
+        a_benchmark_debug_print("amg8833: unknown status code.\n");
+    }
+
+    return res;
+}
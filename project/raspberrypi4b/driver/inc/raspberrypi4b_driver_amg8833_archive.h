@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_archive.h
+ * @brief     raspberrypi4b_driver amg8833 archive header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_AMG8833_ARCHIVE_H
+#define RASPBERRYPI4B_DRIVER_AMG8833_ARCHIVE_H
+
+#include "driver_amg8833_record.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_amg8833_archive raspberrypi4b amg8833 archive function
+ * @brief    raspberrypi4b amg8833 archive modules
+ * @{
+ */
+
+/**
+ * @brief amg8833 archive definition
+ */
+#define AMG8833_ARCHIVE_VERSION            0x0001        /**< archive format version */
+#define AMG8833_ARCHIVE_HEADER_SIZE        64            /**< file header size */
+#define AMG8833_ARCHIVE_ANY_SENSOR         0xFF          /**< iterate the frames of all sensors */
+
+/**
+ * @brief amg8833 archive run frame number definition
+ * @note  the build sorts the record in runs of this many frames and merges them, it bounds the build memory
+ */
+#ifndef AMG8833_ARCHIVE_RUN_FRAMES
+    #define AMG8833_ARCHIVE_RUN_FRAMES 4096        /**< 576 KB of entries */
+#endif
+
+/**
+ * @brief amg8833 archive merge way number definition
+ * @note  the build merges at most this many runs at once, a longer record takes more merge passes
+ */
+#ifndef AMG8833_ARCHIVE_MERGE_WAYS
+    #define AMG8833_ARCHIVE_MERGE_WAYS 64        /**< 144 KB of run buffers */
+#endif
+
+/**
+ * @brief amg8833 archive entry structure definition
+ * @note  the entries follow the 64 bytes file header as a little endian array sorted by timestamp,
+ *        the archive is mapped and read in place so it must be read on a little endian host
+ */
+typedef struct amg8833_archive_entry_s
+{
+    uint64_t timestamp;                             /**< timestamp in us */
+    uint8_t sensor;                                 /**< sensor id */
+    uint8_t status;                                 /**< stat register */
+    int16_t thermistor;                             /**< thermistor temperature, 0.0625C per lsb */
+    uint32_t reserved;                              /**< reserved */
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];         /**< pixel registers, see AMG8833_FRAME_PIXEL */
+} amg8833_archive_entry_t;
+
+/**
+ * @brief amg8833 archive structure definition
+ */
+typedef struct amg8833_archive_s
+{
+    int fd;                                                          /**< file descriptor */
+    const uint8_t *map;                                              /**< mapped file */
+    size_t size;                                                     /**< mapped size */
+    const amg8833_archive_entry_t *entry;                            /**< entry array */
+    uint32_t frames;                                                 /**< entry number */
+    uint64_t first;                                                  /**< first timestamp */
+    uint64_t last;                                                   /**< last timestamp */
+    const uint32_t *index[AMG8833_RECORD_MAX_SENSOR];                /**< entry number list of every sensor */
+    uint32_t index_num[AMG8833_RECORD_MAX_SENSOR];                   /**< entry number of every sensor */
+} amg8833_archive_t;
+
+/**
+ * @brief amg8833 archive cursor structure definition
+ */
+typedef struct amg8833_archive_cursor_s
+{
+    uint8_t sensor;        /**< sensor id or AMG8833_ARCHIVE_ANY_SENSOR */
+    uint32_t pos;          /**< position in the sensor list or in the entry array */
+} amg8833_archive_cursor_t;
+
+/**
+ * @brief     build an archive from a record file
+ * @param[in] *record_name pointer to a record file name
+ * @param[in] *archive_name pointer to an archive file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 build failed
+ * @note      the archive is written to a temporary file and renamed when complete,
+ *            corrupt records of the record file are skipped,
+ *            the frames are sorted in runs of AMG8833_ARCHIVE_RUN_FRAMES in an unlinked run file and merged
+ *            with a heap over at most AMG8833_ARCHIVE_MERGE_WAYS runs, more runs take more merge passes,
+ *            the build state is allocated by every call so the build is reentrant
+ */
+uint8_t amg8833_archive_build(const char *record_name, const char *archive_name);
+
+/**
+ * @brief     open an archive
+ * @param[in] *archive pointer to an archive structure
+ * @param[in] *name pointer to an archive file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 archive is invalid
+ * @note      the file is mapped read only and nothing is copied
+ */
+uint8_t amg8833_archive_open(amg8833_archive_t *archive, const char *name);
+
+/**
+ * @brief     close an archive
+ * @param[in] *archive pointer to an archive structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the entry pointers of the archive are invalid after closing
+ */
+uint8_t amg8833_archive_close(amg8833_archive_t *archive);
+
+/**
+ * @brief      seek to a timestamp
+ * @param[in]  *archive pointer to an archive structure
+ * @param[in]  sensor sensor id or AMG8833_ARCHIVE_ANY_SENSOR
+ * @param[in]  timestamp timestamp in us
+ * @param[out] *cursor pointer to a cursor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 seek failed
+ *             - 2 sensor is invalid
+ * @note       the cursor points to the first frame at or after timestamp, the search is a binary search
+ */
+uint8_t amg8833_archive_seek(amg8833_archive_t *archive, uint8_t sensor, uint64_t timestamp, amg8833_archive_cursor_t *cursor);
+
+/**
+ * @brief         get the next frame
+ * @param[in]     *archive pointer to an archive structure
+ * @param[in,out] *cursor pointer to a cursor structure
+ * @param[out]    **entry pointer to an entry pointer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no more frame
+ * @note          the entry points into the mapped file, entry->buf can be given to amg8833_decode_frames
+ *                or AMG8833_FRAME_PIXEL in the same way as a buffer from amg8833_read_temperature_array_buffer
+ */
+uint8_t amg8833_archive_next(amg8833_archive_t *archive, amg8833_archive_cursor_t *cursor, const amg8833_archive_entry_t **entry);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
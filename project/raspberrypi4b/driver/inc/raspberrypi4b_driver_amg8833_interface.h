@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_interface.h
+ * @brief     raspberrypi4b_driver amg8833 interface header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_AMG8833_INTERFACE_H
+#define RASPBERRYPI4B_DRIVER_AMG8833_INTERFACE_H
+
+#include "driver_amg8833_interface.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_amg8833_bus raspberrypi4b amg8833 bus function
+ * @brief    raspberrypi4b amg8833 bus modules
+ * @{
+ */
+
+/**
+ * @brief amg8833 interface bus structure definition
+ */
+typedef struct amg8833_interface_bus_s
+{
+    char name[32];                /**< iic device name */
+    int fd;                       /**< iic handle */
+    uint32_t ref;                 /**< reference count */
+    pthread_mutex_t mutex;        /**< reference mutex */
+} amg8833_interface_bus_t;
+
+/**
+ * @brief     init the bus context
+ * @param[in] *bus pointer to a bus context
+ * @param[in] *name pointer to an iic device name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      link the bus context with DRIVER_AMG8833_LINK_USER and the interface
+ *            context functions, all the handles on the same bus share one bus context
+ */
+uint8_t amg8833_interface_bus_init(amg8833_interface_bus_t *bus, const char *name);
+
+/**
+ * @brief     deinit the bus context
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      all the handles on the bus must be closed before
+ */
+uint8_t amg8833_interface_bus_deinit(amg8833_interface_bus_t *bus);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
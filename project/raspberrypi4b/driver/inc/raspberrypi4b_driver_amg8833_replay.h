@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_replay.h
+ * @brief     raspberrypi4b_driver amg8833 replay header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_AMG8833_REPLAY_H
+#define RASPBERRYPI4B_DRIVER_AMG8833_REPLAY_H
+
+#include "driver_amg8833_record.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_amg8833_replay raspberrypi4b amg8833 replay function
+ * @brief    raspberrypi4b amg8833 replay modules
+ * @{
+ */
+
+/**
+ * @brief amg8833 replay mode enumeration definition
+ */
+typedef enum
+{
+    AMG8833_REPLAY_MODE_FAST     = 0x00,        /**< every read of the pixel registers serves the next frame */
+    AMG8833_REPLAY_MODE_REALTIME = 0x01,        /**< frames are served at their recorded times */
+} amg8833_replay_mode_t;
+
+/**
+ * @brief amg8833 replay structure definition
+ */
+typedef struct amg8833_replay_s
+{
+    int fd;                                      /**< file descriptor */
+    const uint8_t *map;                          /**< mapped file */
+    size_t size;                                 /**< mapped size */
+    uint8_t container;                           /**< record container flag */
+    uint8_t sensor;                              /**< served sensor id */
+    uint8_t mode;                                /**< replay mode */
+    uint8_t loop;                                /**< loop flag */
+    uint8_t end;                                 /**< end of file flag */
+    uint8_t next_valid;                          /**< next frame valid flag */
+    uint32_t pos;                                /**< plain file offset */
+    uint64_t start;                              /**< real time of the first frame in us */
+    uint64_t first;                              /**< timestamp of the first frame in us */
+    uint64_t frames;                             /**< served frame number */
+    uint32_t reads;                              /**< read transaction number */
+    uint32_t writes;                             /**< write transaction number */
+    amg8833_record_reader_t reader;              /**< record reader */
+    amg8833_record_frame_t frame;                /**< current frame */
+    amg8833_record_frame_t next;                 /**< next frame */
+    uint8_t reg[256];                            /**< register map */
+} amg8833_replay_t;
+
+/**
+ * @brief     open a replay
+ * @param[in] *replay pointer to a replay structure
+ * @param[in] *name pointer to a record file or a file of frame buffers
+ * @param[in] sensor served sensor id
+ * @param[in] mode replay mode
+ * @param[in] loop restart from the first frame at the end of the file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 file is empty
+ * @note      link the replay with DRIVER_AMG8833_LINK_USER and the replay context functions,
+ *            frames of the other sensors are skipped, a plain file only holds sensor 0,
+ *            frames of a plain file are 100 ms apart and have no thermistor or status
+ */
+uint8_t amg8833_replay_open(amg8833_replay_t *replay, const char *name, uint8_t sensor, amg8833_replay_mode_t mode, uint8_t loop);
+
+/**
+ * @brief     close a replay
+ * @param[in] *replay pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t amg8833_replay_close(amg8833_replay_t *replay);
+
+/**
+ * @brief      get the replay statistics
+ * @param[in]  *replay pointer to a replay structure
+ * @param[out] *frames pointer to a served frame number buffer
+ * @param[out] *reads pointer to a read transaction number buffer
+ * @param[out] *writes pointer to a write transaction number buffer
+ * @param[out] *end pointer to an end of file flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       after the end the last frame is served again
+ */
+uint8_t amg8833_replay_get_statistics(amg8833_replay_t *replay, uint64_t *frames, uint32_t *reads, uint32_t *writes, uint8_t *end);
+
+/**
+ * @brief     replay iic bus init
+ * @param[in] *user pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_replay_iic_init_ctx(void *user);
+
+/**
+ * @brief     replay iic bus deinit
+ * @param[in] *user pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_replay_iic_deinit_ctx(void *user);
+
+/**
+ * @brief      replay iic bus read
+ * @param[in]  *user pointer to a replay structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the pixel, thermistor and status registers come from the frame file, the others from the register map
+ */
+uint8_t amg8833_replay_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     replay iic bus write
+ * @param[in] *user pointer to a replay structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the initial reset clears the register map, the flag reset and the sclr register clear the status,
+ *            writes to the status, thermistor and interrupt result registers are ignored
+ */
+uint8_t amg8833_replay_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     replay delay ms
+ * @param[in] ms time
+ * @note      returns at once for fast replays, link amg8833_interface_delay_ms for real time replays
+ */
+void amg8833_replay_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_scheduler.h
+ * @brief     raspberrypi4b_driver amg8833 scheduler header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_AMG8833_SCHEDULER_H
+#define RASPBERRYPI4B_DRIVER_AMG8833_SCHEDULER_H
+
+#include "driver_amg8833_interface.h"
+#include "driver_amg8833_ring.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_amg8833_scheduler raspberrypi4b amg8833 scheduler function
+ * @brief    raspberrypi4b amg8833 scheduler modules
+ * @{
+ */
+
+/**
+ * @brief amg8833 scheduler definition
+ */
+#define AMG8833_SCHEDULER_MAX_SENSOR        16        /**< max sensor number */
+#define AMG8833_SCHEDULER_MAX_BUS           8         /**< max bus number */
+#define AMG8833_SCHEDULER_RING_SIZE         16        /**< frame number of every sensor ring, must be a power of two */
+
+/**
+ * @brief amg8833 scheduler sensor structure definition
+ */
+typedef struct amg8833_scheduler_sensor_s
+{
+    amg8833_ring_t ring;                                                  /**< frame ring */
+    amg8833_ring_frame_t frame[AMG8833_SCHEDULER_RING_SIZE];              /**< frame storage */
+    amg8833_handle_t *handle;                                             /**< amg8833 handle */
+    uint64_t phase;                                                       /**< read phase in ns */
+    volatile uint32_t errors;                                             /**< read error number */
+    volatile uint32_t overruns;                                           /**< missed deadline number */
+} amg8833_scheduler_sensor_t;
+
+/**
+ * @brief amg8833 scheduler bus structure definition
+ */
+typedef struct amg8833_scheduler_bus_s
+{
+    struct amg8833_scheduler_s *scheduler;                /**< scheduler */
+    void *user;                                           /**< bus context */
+    pthread_t thread;                                     /**< bus thread */
+    uint8_t sensor[AMG8833_SCHEDULER_MAX_SENSOR];         /**< sensor index list */
+    uint8_t sensor_num;                                   /**< sensor number */
+} amg8833_scheduler_bus_t;
+
+/**
+ * @brief amg8833 scheduler structure definition
+ */
+typedef struct amg8833_scheduler_s
+{
+    amg8833_scheduler_sensor_t sensor[AMG8833_SCHEDULER_MAX_SENSOR];        /**< sensor list */
+    amg8833_scheduler_bus_t bus[AMG8833_SCHEDULER_MAX_BUS];                 /**< bus list */
+    uint8_t sensor_num;                                                     /**< sensor number */
+    uint8_t bus_num;                                                        /**< bus number */
+    uint64_t period;                                                        /**< frame period in ns */
+    uint64_t start;                                                         /**< start time in ns */
+    volatile uint8_t running;                                               /**< running flag */
+} amg8833_scheduler_t;
+
+/**
+ * @brief     init the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @param[in] period_ms frame period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_init(amg8833_scheduler_t *scheduler, uint32_t period_ms);
+
+/**
+ * @brief     deinit the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the scheduler must be stopped before
+ */
+uint8_t amg8833_scheduler_deinit(amg8833_scheduler_t *scheduler);
+
+/**
+ * @brief      add a sensor to the scheduler
+ * @param[in]  *scheduler pointer to a scheduler structure
+ * @param[in]  *handle pointer to an initialized amg8833 handle structure
+ * @param[out] *id pointer to a sensor id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ * @note       the sensors are grouped into buses by the handle user context,
+ *             every bus is polled by its own thread
+ */
+uint8_t amg8833_scheduler_add(amg8833_scheduler_t *scheduler, amg8833_handle_t *handle, uint8_t *id);
+
+/**
+ * @brief     start the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the reads of the sensors on the same bus are staggered evenly over one period
+ */
+uint8_t amg8833_scheduler_start(amg8833_scheduler_t *scheduler);
+
+/**
+ * @brief     stop the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_stop(amg8833_scheduler_t *scheduler);
+
+/**
+ * @brief         read the frames of a sensor
+ * @param[in]     *scheduler pointer to a scheduler structure
+ * @param[in]     id sensor id
+ * @param[out]    *frame pointer to a frame array
+ * @param[in,out] *len pointer to a frame number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no frame
+ *                - 2 id is invalid
+ * @note          every sensor supports one reader thread, the timestamp is the CLOCK_MONOTONIC time in ns,
+ *                new frames are dropped when the ring is full and leave a gap in the sequence numbers
+ */
+uint8_t amg8833_scheduler_read(amg8833_scheduler_t *scheduler, uint8_t id, amg8833_ring_frame_t *frame, uint32_t *len);
+
+/**
+ * @brief      get the sensor statistics
+ * @param[in]  *scheduler pointer to a scheduler structure
+ * @param[in]  id sensor id
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @param[out] *errors pointer to a read error number buffer
+ * @param[out] *overruns pointer to a missed deadline number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 id is invalid
+ * @note       none
+ */
+uint8_t amg8833_scheduler_get_statistics(amg8833_scheduler_t *scheduler, uint8_t id,
+                                         uint32_t *dropped, uint32_t *errors, uint32_t *overruns);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
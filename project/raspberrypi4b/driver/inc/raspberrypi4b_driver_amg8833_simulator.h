@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_simulator.h
+ * @brief     raspberrypi4b_driver amg8833 simulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_AMG8833_SIMULATOR_H
+#define RASPBERRYPI4B_DRIVER_AMG8833_SIMULATOR_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup raspberrypi4b_amg8833_simulator raspberrypi4b amg8833 simulator function
+ * @brief    raspberrypi4b amg8833 simulator modules
+ * @{
+ */
+
+/**
+ * @brief amg8833 simulator scene definition
+ * @note  pixel is in the register order with 0.25C per lsb, thermistor is 0.0625C per lsb
+ */
+typedef void (*amg8833_simulator_scene_t)(void *user, uint64_t time_us, int16_t pixel[64], int16_t *thermistor);
+
+/**
+ * @brief amg8833 simulator structure definition
+ */
+typedef struct amg8833_simulator_s
+{
+    uint8_t reg[256];                        /**< register map */
+    uint64_t now;                            /**< simulated time in us */
+    uint64_t next;                           /**< next frame time in us */
+    uint32_t frames;                         /**< frame number */
+    uint32_t seed;                           /**< noise seed */
+    int16_t sample[64];                      /**< last sample */
+    int16_t out[64];                         /**< last output */
+    uint64_t high;                           /**< pixels over the high level */
+    uint64_t low;                            /**< pixels under the low level */
+    uint32_t reads;                          /**< read transaction number */
+    uint32_t writes;                         /**< write transaction number */
+    uint64_t read_bytes;                     /**< read byte number */
+    uint64_t write_bytes;                    /**< write byte number */
+    amg8833_simulator_scene_t scene;         /**< scene function */
+    void *user;                              /**< scene context */
+} amg8833_simulator_t;
+
+/**
+ * @brief     init the simulator
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] seed noise seed
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the sensor starts in the normal mode at 10 fps with the first frame ready,
+ *            the default scene is a warm body walking across a 22C room
+ */
+uint8_t amg8833_simulator_init(amg8833_simulator_t *simulator, uint32_t seed);
+
+/**
+ * @brief     set the scene
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] scene scene function, NULL restores the default scene
+ * @param[in] *user pointer to a scene context
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t amg8833_simulator_set_scene(amg8833_simulator_t *simulator, amg8833_simulator_scene_t scene, void *user);
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] us time in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 advance failed
+ * @note      every frame due in the time is sampled, averaged and checked for interrupts
+ */
+uint8_t amg8833_simulator_advance(amg8833_simulator_t *simulator, uint32_t us);
+
+/**
+ * @brief      get the int pin
+ * @param[in]  *simulator pointer to a simulator structure
+ * @param[out] *level pointer to a level buffer, 1 means the active low pin is asserted
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_get_int_pin(amg8833_simulator_t *simulator, uint8_t *level);
+
+/**
+ * @brief      get the bus statistics
+ * @param[in]  *simulator pointer to a simulator structure
+ * @param[out] *reads pointer to a read transaction number buffer
+ * @param[out] *writes pointer to a write transaction number buffer
+ * @param[out] *read_bytes pointer to a read byte number buffer
+ * @param[out] *write_bytes pointer to a write byte number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_get_statistics(amg8833_simulator_t *simulator, uint32_t *reads, uint32_t *writes,
+                                         uint64_t *read_bytes, uint64_t *write_bytes);
+
+/**
+ * @brief     clear the bus statistics
+ * @param[in] *simulator pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      none
+ */
+uint8_t amg8833_simulator_clear_statistics(amg8833_simulator_t *simulator);
+
+/**
+ * @brief     simulator iic bus init
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_simulator_iic_init_ctx(void *user);
+
+/**
+ * @brief     simulator iic bus deinit
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_simulator_iic_deinit_ctx(void *user);
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  *user pointer to a simulator structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] *user pointer to a simulator structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      read only registers ignore the write
+ */
+uint8_t amg8833_simulator_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,869 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_archive.c
+ * @brief     raspberrypi4b_driver amg8833 archive source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_amg8833_archive.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief archive magic definition
+ */
+static const uint8_t gs_archive_magic[4] = {'A', 'M', 'G', 'A'};        /**< archive magic */
+
+/**
+ * @brief     put a little endian value
+ * @param[in] *p pointer to a buffer
+ * @param[in] v value
+ * @param[in] len byte number
+ * @note      none
+ */
+static void a_archive_put(uint8_t *p, uint64_t v, uint8_t len)
+{
+    uint8_t i;
+    
+    for (i = 0; i < len; i++)
+    {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+/**
+ * @brief     get a little endian value
+ * @param[in] *p pointer to a buffer
+ * @param[in] len byte number
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_archive_get(const uint8_t *p, uint8_t len)
+{
+    uint64_t v;
+    uint8_t i;
+    
+    v = 0;
+    for (i = 0; i < len; i++)
+    {
+        v |= (uint64_t)p[i] << (8 * i);
+    }
+    
+    return v;
+}
+
+/**
+ * @brief     compare two entries
+ * @param[in] *a pointer to an entry
+ * @param[in] *b pointer to an entry
+ * @return    compare result
+ * @note      the reserved field holds the record order while sorting so equal timestamps keep it
+ */
+static int a_archive_compare(const void *a, const void *b)
+{
+    const amg8833_archive_entry_t *x = (const amg8833_archive_entry_t *)a;
+    const amg8833_archive_entry_t *y = (const amg8833_archive_entry_t *)b;
+    
+    if (x->timestamp != y->timestamp)
+    {
+        return (x->timestamp < y->timestamp) ? -1 : 1;
+    }
+    if (x->reserved != y->reserved)
+    {
+        return (x->reserved < y->reserved) ? -1 : 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief archive merge definition
+ */
+#define AMG8833_ARCHIVE_MERGE_FRAMES        16         /**< read frames of every run */
+#define AMG8833_ARCHIVE_LIST_SIZE           256        /**< buffered entry numbers of every sensor */
+
+/**
+ * @brief archive run structure definition
+ */
+typedef struct a_archive_run_s
+{
+    uint64_t offset;                                                  /**< next entry offset in the run file */
+    uint32_t left;                                                    /**< entries left in the run file */
+    uint32_t pos;                                                     /**< position in the buffer */
+    uint32_t num;                                                     /**< entries in the buffer */
+    amg8833_archive_entry_t buf[AMG8833_ARCHIVE_MERGE_FRAMES];        /**< buffered entries */
+} a_archive_run_t;
+
+/**
+ * @brief archive build context structure definition
+ * @note  allocated by every build so the build keeps no static state
+ */
+typedef struct a_archive_context_s
+{
+    amg8833_record_reader_t reader;                                                /**< record reader */
+    a_archive_run_t run[AMG8833_ARCHIVE_MERGE_WAYS];                               /**< merged runs */
+    uint32_t heap[AMG8833_ARCHIVE_MERGE_WAYS];                                     /**< runs ordered by the head entry */
+    uint32_t heap_num;                                                             /**< runs in the heap */
+    uint8_t list[AMG8833_RECORD_MAX_SENSOR][AMG8833_ARCHIVE_LIST_SIZE * 4];        /**< buffered entry lists */
+} a_archive_context_t;
+
+/**
+ * @brief     fill the buffer of a run
+ * @param[in] *fp pointer to the run file
+ * @param[in] *run pointer to a run structure
+ * @return    status code
+ *            - 0 the run has an entry
+ *            - 1 the run is empty
+ *            - 2 read failed
+ * @note      none
+ */
+static uint8_t a_archive_run_fill(FILE *fp, a_archive_run_t *run)
+{
+    uint32_t num;
+    
+    if (run->pos < run->num)
+    {
+        return 0;
+    }
+    if (run->left == 0)
+    {
+        return 1;
+    }
+    num = (run->left < AMG8833_ARCHIVE_MERGE_FRAMES) ? run->left : AMG8833_ARCHIVE_MERGE_FRAMES;
+    if ((fseeko(fp, (off_t)run->offset, SEEK_SET) != 0) || 
+        (fread(run->buf, sizeof(amg8833_archive_entry_t), num, fp) != num))
+    {
+        return 2;
+    }
+    run->offset += (uint64_t)num * sizeof(amg8833_archive_entry_t);
+    run->left -= num;
+    run->pos = 0;
+    run->num = num;
+    
+    return 0;
+}
+
+/**
+ * @brief     move a heap node down to its place
+ * @param[in] *ctx pointer to a context structure
+ * @param[in] i heap node
+ * @note      the heap root is the run with the smallest head entry
+ */
+static void a_archive_heap_down(a_archive_context_t *ctx, uint32_t i)
+{
+    a_archive_run_t *a;
+    a_archive_run_t *b;
+    uint32_t c;
+    uint32_t t;
+    
+    while ((c = i * 2 + 1) < ctx->heap_num)
+    {
+        /* the smaller child */
+        if (c + 1 < ctx->heap_num)
+        {
+            a = &ctx->run[ctx->heap[c + 1]];
+            b = &ctx->run[ctx->heap[c]];
+            if (a_archive_compare(&a->buf[a->pos], &b->buf[b->pos]) < 0)
+            {
+                c++;
+            }
+        }
+        
+        /* stop when the node is not larger */
+        a = &ctx->run[ctx->heap[c]];
+        b = &ctx->run[ctx->heap[i]];
+        if (a_archive_compare(&a->buf[a->pos], &b->buf[b->pos]) >= 0)
+        {
+            break;
+        }
+        t = ctx->heap[i];
+        ctx->heap[i] = ctx->heap[c];
+        ctx->heap[c] = t;
+        i = c;
+    }
+}
+
+/**
+ * @brief     start merging a group of runs
+ * @param[in] *ctx pointer to a context structure
+ * @param[in] *fp pointer to the run file
+ * @param[in] first first run of the group
+ * @param[in] ways run number of the group
+ * @param[in] run_frames entry number of a full run
+ * @param[in] frames entry number of the run file
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      the runs lie one after another in the run file and only the last one may be shorter
+ */
+static uint8_t a_archive_heap_init(a_archive_context_t *ctx, FILE *fp, uint32_t first, uint32_t ways,
+                                   uint64_t run_frames, uint32_t frames)
+{
+    uint64_t start;
+    uint32_t r;
+    uint32_t i;
+    uint8_t res;
+    
+    ctx->heap_num = 0;
+    for (r = 0; r < ways; r++)
+    {
+        start = (uint64_t)(first + r) * run_frames;
+        ctx->run[r].offset = start * sizeof(amg8833_archive_entry_t);
+        ctx->run[r].left = (uint32_t)(((frames - start) < run_frames) ? (frames - start) : run_frames);
+        ctx->run[r].pos = 0;
+        ctx->run[r].num = 0;
+        res = a_archive_run_fill(fp, &ctx->run[r]);
+        if (res == 2)
+        {
+            return 1;
+        }
+        if (res == 0)
+        {
+            ctx->heap[ctx->heap_num] = r;
+            ctx->heap_num++;
+        }
+    }
+    for (i = ctx->heap_num / 2; i > 0; i--)
+    {
+        a_archive_heap_down(ctx, i - 1);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      take the smallest head of the merged runs
+ * @param[in]  *ctx pointer to a context structure
+ * @param[in]  *fp pointer to the run file
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more entry
+ *             - 2 read failed
+ * @note       none
+ */
+static uint8_t a_archive_heap_pop(a_archive_context_t *ctx, FILE *fp, amg8833_archive_entry_t *entry)
+{
+    a_archive_run_t *run;
+    uint8_t res;
+    
+    if (ctx->heap_num == 0)
+    {
+        return 1;
+    }
+    run = &ctx->run[ctx->heap[0]];
+    *entry = run->buf[run->pos];
+    run->pos++;
+    res = a_archive_run_fill(fp, run);
+    if (res == 2)
+    {
+        return 2;
+    }
+    if (res == 1)
+    {
+        ctx->heap_num--;
+        ctx->heap[0] = ctx->heap[ctx->heap_num];
+    }
+    a_archive_heap_down(ctx, 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     merge every group of runs into one longer run
+ * @param[in] *ctx pointer to a context structure
+ * @param[in] *fp pointer to the run file
+ * @param[in] *out_fp pointer to the output run file
+ * @param[in] runs run number
+ * @param[in] run_frames entry number of a full run
+ * @param[in] frames entry number of the run file
+ * @return    status code
+ *            - 0 success
+ *            - 1 merge failed
+ * @note      a group is AMG8833_ARCHIVE_MERGE_WAYS runs and the record order is kept for the next pass
+ */
+static uint8_t a_archive_merge_pass(a_archive_context_t *ctx, FILE *fp, FILE *out_fp, uint32_t runs,
+                                    uint64_t run_frames, uint32_t frames)
+{
+    amg8833_archive_entry_t entry;
+    uint32_t ways;
+    uint32_t r;
+    uint8_t res;
+    
+    for (r = 0; r < runs; r += ways)
+    {
+        ways = ((runs - r) < AMG8833_ARCHIVE_MERGE_WAYS) ? (runs - r) : AMG8833_ARCHIVE_MERGE_WAYS;
+        if (a_archive_heap_init(ctx, fp, r, ways, run_frames, frames) != 0)
+        {
+            return 1;
+        }
+        while ((res = a_archive_heap_pop(ctx, fp, &entry)) == 0)
+        {
+            if (fwrite(&entry, sizeof(amg8833_archive_entry_t), 1, out_fp) != 1)
+            {
+                return 1;
+            }
+        }
+        if (res != 1)
+        {
+            return 1;
+        }
+    }
+    if (fflush(out_fp) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     merge the sorted runs into the archive
+ * @param[in] *fp pointer to the archive file
+ * @param[in] *ctx pointer to a context structure
+ * @param[in] *run_fp pointer to the run file
+ * @param[in] runs run number, at most AMG8833_ARCHIVE_MERGE_WAYS
+ * @param[in] run_frames entry number of a full run
+ * @param[in] frames entry number
+ * @param[in] *num pointer to the entry number of every sensor
+ * @param[in] first first timestamp
+ * @param[in] last last timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the entries are written in order, the entry lists of the sensors are buffered
+ *            and written in place after the index table
+ */
+static uint8_t a_archive_merge(FILE *fp, a_archive_context_t *ctx, FILE *run_fp, uint32_t runs, uint64_t run_frames,
+                               uint32_t frames, const uint32_t *num, uint64_t first, uint64_t last)
+{
+    uint8_t header[AMG8833_ARCHIVE_HEADER_SIZE];
+    uint8_t table[AMG8833_RECORD_MAX_SENSOR * 8];
+    uint32_t start[AMG8833_RECORD_MAX_SENSOR];
+    uint32_t done[AMG8833_RECORD_MAX_SENSOR];
+    uint32_t list_num[AMG8833_RECORD_MAX_SENSOR];
+    amg8833_archive_entry_t entry;
+    uint64_t list_base;
+    uint32_t i;
+    uint8_t j;
+    
+    /* the index table from the entry number of every sensor */
+    start[0] = 0;
+    for (j = 0; j < AMG8833_RECORD_MAX_SENSOR; j++)
+    {
+        if (j != 0)
+        {
+            start[j] = start[j - 1] + num[j - 1];
+        }
+        a_archive_put(&table[j * 8 + 0], start[j], 4);
+        a_archive_put(&table[j * 8 + 4], num[j], 4);
+        done[j] = 0;
+        list_num[j] = 0;
+    }
+    
+    /* header, entries, index table and the entry lists */
+    memset(header, 0, sizeof(header));
+    memcpy(&header[0], gs_archive_magic, 4);
+    a_archive_put(&header[4], AMG8833_ARCHIVE_VERSION, 2);
+    a_archive_put(&header[6], sizeof(amg8833_archive_entry_t), 2);
+    a_archive_put(&header[8], frames, 4);
+    a_archive_put(&header[16], AMG8833_ARCHIVE_HEADER_SIZE + (uint64_t)frames * sizeof(amg8833_archive_entry_t), 8);
+    a_archive_put(&header[24], first, 8);
+    a_archive_put(&header[32], last, 8);
+    if (fwrite(header, 1, sizeof(header), fp) != sizeof(header))
+    {
+        return 1;
+    }
+    list_base = AMG8833_ARCHIVE_HEADER_SIZE + (uint64_t)frames * sizeof(amg8833_archive_entry_t) + sizeof(table);
+    if (a_archive_heap_init(ctx, run_fp, 0, runs, run_frames, frames) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < frames; i++)
+    {
+        /* take the smallest head of all runs */
+        if (a_archive_heap_pop(ctx, run_fp, &entry) != 0)
+        {
+            return 1;
+        }
+        entry.reserved = 0;
+        if (fwrite(&entry, sizeof(amg8833_archive_entry_t), 1, fp) != 1)
+        {
+            return 1;
+        }
+        
+        /* add the entry number to the list of the sensor */
+        j = entry.sensor;
+        a_archive_put(&ctx->list[j][list_num[j] * 4], i, 4);
+        list_num[j]++;
+        if (list_num[j] == AMG8833_ARCHIVE_LIST_SIZE)
+        {
+            if (pwrite(fileno(fp), ctx->list[j], AMG8833_ARCHIVE_LIST_SIZE * 4,
+                       (off_t)(list_base + ((uint64_t)start[j] + done[j]) * 4)) != AMG8833_ARCHIVE_LIST_SIZE * 4)
+            {
+                return 1;
+            }
+            done[j] += AMG8833_ARCHIVE_LIST_SIZE;
+            list_num[j] = 0;
+        }
+    }
+    if (fwrite(table, 1, sizeof(table), fp) != sizeof(table))
+    {
+        return 1;
+    }
+    for (j = 0; j < AMG8833_RECORD_MAX_SENSOR; j++)
+    {
+        if ((list_num[j] != 0) && 
+            (pwrite(fileno(fp), ctx->list[j], (size_t)list_num[j] * 4,
+                    (off_t)(list_base + ((uint64_t)start[j] + done[j]) * 4)) != (ssize_t)list_num[j] * 4))
+        {
+            return 1;
+        }
+    }
+    if (fflush(fp) != 0)
+    {
+        return 1;
+    }
+    if (fsync(fileno(fp)) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     build an archive from a record file
+ * @param[in] *record_name pointer to a record file name
+ * @param[in] *archive_name pointer to an archive file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 build failed
+ * @note      the archive is written to a temporary file and renamed when complete,
+ *            corrupt records of the record file are skipped,
+ *            the frames are sorted in runs of AMG8833_ARCHIVE_RUN_FRAMES in an unlinked run file and merged
+ *            with a heap over at most AMG8833_ARCHIVE_MERGE_WAYS runs, more runs take more merge passes,
+ *            the build state is allocated by every call so the build is reentrant
+ */
+uint8_t amg8833_archive_build(const char *record_name, const char *archive_name)
+{
+    a_archive_context_t *ctx;
+    amg8833_record_frame_t frame;
+    amg8833_archive_entry_t *entry;
+    struct stat st;
+    const uint8_t *map;
+    char tmp_name[512];
+    uint32_t num[AMG8833_RECORD_MAX_SENSOR];
+    uint64_t run_frames;
+    uint64_t first;
+    uint64_t last;
+    uint32_t frames;
+    uint32_t runs;
+    uint32_t n;
+    uint8_t res;
+    FILE *out_fp;
+    FILE *run_fp;
+    FILE *fp;
+    int fd;
+    
+    if ((record_name == NULL) || (archive_name == NULL))
+    {
+        return 1;
+    }
+    
+    /* map the record file */
+    fd = open(record_name, O_RDONLY);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size <= 0) || ((uint64_t)st.st_size > AMG8833_RECORD_MAX_FILE_SIZE))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    map = (const uint8_t *)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED)
+    {
+        return 1;
+    }
+    ctx = (a_archive_context_t *)malloc(sizeof(a_archive_context_t));
+    if ((ctx == NULL) || (amg8833_record_reader_init(&ctx->reader, map, (uint32_t)st.st_size) != 0))
+    {
+        free(ctx);
+        (void)munmap((void *)map, (size_t)st.st_size);
+        
+        return 1;
+    }
+    
+    /* the run file is unlinked at once and deleted when closed */
+    entry = (amg8833_archive_entry_t *)malloc(sizeof(amg8833_archive_entry_t) * AMG8833_ARCHIVE_RUN_FRAMES);
+    (void)snprintf(tmp_name, sizeof(tmp_name), "%s.run", archive_name);
+    run_fp = fopen(tmp_name, "w+b");
+    if ((entry == NULL) || (run_fp == NULL))
+    {
+        free(entry);
+        if (run_fp != NULL)
+        {
+            (void)fclose(run_fp);
+            (void)remove(tmp_name);
+        }
+        free(ctx);
+        (void)munmap((void *)map, (size_t)st.st_size);
+        
+        return 1;
+    }
+    (void)remove(tmp_name);
+    
+    /* decode the frames and write them as sorted runs */
+    memset(num, 0, sizeof(num));
+    first = UINT64_MAX;
+    last = 0;
+    frames = 0;
+    runs = 0;
+    n = 0;
+    res = 0;
+    while (res == 0)
+    {
+        res = amg8833_record_reader_read(&ctx->reader, &frame);
+        if (res == 0)
+        {
+            entry[n].timestamp = frame.timestamp;
+            entry[n].sensor = frame.sensor;
+            entry[n].status = frame.status;
+            entry[n].thermistor = frame.thermistor;
+            entry[n].reserved = frames;
+            memcpy(entry[n].buf, frame.buf, AMG8833_FRAME_BUFFER_SIZE);
+            num[frame.sensor]++;
+            first = (frame.timestamp < first) ? frame.timestamp : first;
+            last = (frame.timestamp > last) ? frame.timestamp : last;
+            frames++;
+            n++;
+        }
+        if ((n == AMG8833_ARCHIVE_RUN_FRAMES) || ((res != 0) && (n != 0)))
+        {
+            qsort(entry, n, sizeof(amg8833_archive_entry_t), a_archive_compare);
+            if (fwrite(entry, sizeof(amg8833_archive_entry_t), n, run_fp) != n)
+            {
+                free(entry);
+                (void)fclose(run_fp);
+                free(ctx);
+                (void)munmap((void *)map, (size_t)st.st_size);
+                
+                return 1;
+            }
+            runs++;
+            n = 0;
+        }
+    }
+    free(entry);
+    (void)munmap((void *)map, (size_t)st.st_size);
+    if (frames == 0)
+    {
+        first = 0;
+    }
+    
+    /* merge groups of runs into longer runs until one merge is enough */
+    run_frames = AMG8833_ARCHIVE_RUN_FRAMES;
+    while (runs > AMG8833_ARCHIVE_MERGE_WAYS)
+    {
+        out_fp = fopen(tmp_name, "w+b");
+        if ((out_fp == NULL) || (fflush(run_fp) != 0))
+        {
+            if (out_fp != NULL)
+            {
+                (void)fclose(out_fp);
+                (void)remove(tmp_name);
+            }
+            (void)fclose(run_fp);
+            free(ctx);
+            
+            return 1;
+        }
+        (void)remove(tmp_name);
+        res = a_archive_merge_pass(ctx, run_fp, out_fp, runs, run_frames, frames);
+        (void)fclose(run_fp);
+        run_fp = out_fp;
+        if (res != 0)
+        {
+            (void)fclose(run_fp);
+            free(ctx);
+            
+            return 1;
+        }
+        run_frames *= AMG8833_ARCHIVE_MERGE_WAYS;
+        runs = (uint32_t)((frames + run_frames - 1) / run_frames);
+    }
+    
+    /* merge the runs, write and rename */
+    (void)snprintf(tmp_name, sizeof(tmp_name), "%s.tmp", archive_name);
+    fp = fopen(tmp_name, "wb");
+    if ((fp == NULL) || (fflush(run_fp) != 0))
+    {
+        if (fp != NULL)
+        {
+            (void)fclose(fp);
+            (void)remove(tmp_name);
+        }
+        (void)fclose(run_fp);
+        free(ctx);
+        
+        return 1;
+    }
+    res = a_archive_merge(fp, ctx, run_fp, runs, run_frames, frames, num, first, last);
+    (void)fclose(run_fp);
+    free(ctx);
+    if ((fclose(fp) != 0) || (res != 0))
+    {
+        (void)remove(tmp_name);
+        
+        return 1;
+    }
+    if (rename(tmp_name, archive_name) != 0)
+    {
+        (void)remove(tmp_name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     open an archive
+ * @param[in] *archive pointer to an archive structure
+ * @param[in] *name pointer to an archive file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 archive is invalid
+ * @note      the file is mapped read only and nothing is copied
+ */
+uint8_t amg8833_archive_open(amg8833_archive_t *archive, const char *name)
+{
+    struct stat st;
+    const uint8_t *table;
+    uint64_t index;
+    uint64_t lists;
+    uint32_t start;
+    uint32_t num;
+    uint8_t j;
+    
+    if ((archive == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    
+    /* map the file */
+    archive->map = NULL;
+    archive->fd = open(name, O_RDONLY);
+    if (archive->fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(archive->fd, &st) != 0) || ((uint64_t)st.st_size < AMG8833_ARCHIVE_HEADER_SIZE))
+    {
+        (void)close(archive->fd);
+        
+        return 2;
+    }
+    archive->size = (size_t)st.st_size;
+    archive->map = (const uint8_t *)mmap(NULL, archive->size, PROT_READ, MAP_SHARED, archive->fd, 0);
+    if (archive->map == MAP_FAILED)
+    {
+        (void)close(archive->fd);
+        
+        return 1;
+    }
+    
+    /* check the header */
+    archive->frames = (uint32_t)a_archive_get(&archive->map[8], 4);
+    index = a_archive_get(&archive->map[16], 8);
+    if ((memcmp(archive->map, gs_archive_magic, 4) != 0) || 
+        (a_archive_get(&archive->map[4], 2) != AMG8833_ARCHIVE_VERSION) || 
+        (a_archive_get(&archive->map[6], 2) != sizeof(amg8833_archive_entry_t)) || 
+        (index != AMG8833_ARCHIVE_HEADER_SIZE + (uint64_t)archive->frames * sizeof(amg8833_archive_entry_t)) || 
+        (index + AMG8833_RECORD_MAX_SENSOR * 8 > archive->size))
+    {
+        (void)amg8833_archive_close(archive);
+        
+        return 2;
+    }
+    archive->entry = (const amg8833_archive_entry_t *)&archive->map[AMG8833_ARCHIVE_HEADER_SIZE];
+    archive->first = a_archive_get(&archive->map[24], 8);
+    archive->last = a_archive_get(&archive->map[32], 8);
+    
+    /* check the index table */
+    table = &archive->map[index];
+    lists = (archive->size - index - AMG8833_RECORD_MAX_SENSOR * 8) / 4;
+    for (j = 0; j < AMG8833_RECORD_MAX_SENSOR; j++)
+    {
+        start = (uint32_t)a_archive_get(&table[j * 8 + 0], 4);
+        num = (uint32_t)a_archive_get(&table[j * 8 + 4], 4);
+        if ((uint64_t)start + num > lists)
+        {
+            (void)amg8833_archive_close(archive);
+            
+            return 2;
+        }
+        archive->index[j] = (const uint32_t *)&table[AMG8833_RECORD_MAX_SENSOR * 8 + (size_t)start * 4];
+        archive->index_num[j] = num;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close an archive
+ * @param[in] *archive pointer to an archive structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the entry pointers of the archive are invalid after closing
+ */
+uint8_t amg8833_archive_close(amg8833_archive_t *archive)
+{
+    if ((archive == NULL) || (archive->map == NULL))
+    {
+        return 1;
+    }
+    
+    (void)munmap((void *)archive->map, archive->size);
+    (void)close(archive->fd);
+    archive->map = NULL;
+    archive->entry = NULL;
+    archive->frames = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      seek to a timestamp
+ * @param[in]  *archive pointer to an archive structure
+ * @param[in]  sensor sensor id or AMG8833_ARCHIVE_ANY_SENSOR
+ * @param[in]  timestamp timestamp in us
+ * @param[out] *cursor pointer to a cursor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 seek failed
+ *             - 2 sensor is invalid
+ * @note       the cursor points to the first frame at or after timestamp, the search is a binary search
+ */
+uint8_t amg8833_archive_seek(amg8833_archive_t *archive, uint8_t sensor, uint64_t timestamp, amg8833_archive_cursor_t *cursor)
+{
+    uint32_t low;
+    uint32_t high;
+    uint32_t mid;
+    uint32_t pos;
+    
+    if ((archive == NULL) || (archive->map == NULL) || (cursor == NULL))
+    {
+        return 1;
+    }
+    if ((sensor != AMG8833_ARCHIVE_ANY_SENSOR) && (sensor >= AMG8833_RECORD_MAX_SENSOR))
+    {
+        return 2;
+    }
+    
+    /* lower bound of the timestamp */
+    low = 0;
+    high = (sensor == AMG8833_ARCHIVE_ANY_SENSOR) ? archive->frames : archive->index_num[sensor];
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        pos = (sensor == AMG8833_ARCHIVE_ANY_SENSOR) ? mid : archive->index[sensor][mid];
+        if ((pos < archive->frames) && (archive->entry[pos].timestamp < timestamp))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    cursor->sensor = sensor;
+    cursor->pos = low;
+    
+    return 0;
+}
+
+/**
+ * @brief         get the next frame
+ * @param[in]     *archive pointer to an archive structure
+ * @param[in,out] *cursor pointer to a cursor structure
+ * @param[out]    **entry pointer to an entry pointer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no more frame
+ * @note          the entry points into the mapped file, entry->buf can be given to amg8833_decode_frames
+ *                or AMG8833_FRAME_PIXEL in the same way as a buffer from amg8833_read_temperature_array_buffer
+ */
+uint8_t amg8833_archive_next(amg8833_archive_t *archive, amg8833_archive_cursor_t *cursor, const amg8833_archive_entry_t **entry)
+{
+    uint32_t pos;
+    
+    if ((archive == NULL) || (archive->map == NULL) || (cursor == NULL) || (entry == NULL))
+    {
+        return 1;
+    }
+    
+    if (cursor->sensor == AMG8833_ARCHIVE_ANY_SENSOR)
+    {
+        pos = cursor->pos;
+        if (pos >= archive->frames)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        if ((cursor->sensor >= AMG8833_RECORD_MAX_SENSOR) || (cursor->pos >= archive->index_num[cursor->sensor]))
+        {
+            return 1;
+        }
+        pos = archive->index[cursor->sensor][cursor->pos];
+        if (pos >= archive->frames)
+        {
+            return 1;
+        }
+    }
+    cursor->pos++;
+    *entry = &archive->entry[pos];
+    
+    return 0;
+}
@@ -35,8 +35,10 @@
  */
 
 #include "driver_amg8833_interface.h"
+#include "raspberrypi4b_driver_amg8833_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
@@ -114,6 +116,20 @@ void amg8833_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface get the timestamp in us
+ * @return timestamp
+ * @note   the timestamp wraps around
+ */
+uint32_t amg8833_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000);
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -169,3 +185,188 @@ void amg8833_interface_receive_callback(uint8_t type)
         }
     }
 }
+
+/**
+ * @brief     init the bus context
+ * @param[in] *bus pointer to a bus context
+ * @param[in] *name pointer to an iic device name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t amg8833_interface_bus_init(amg8833_interface_bus_t *bus, const char *name)
+{
+    if ((bus == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    if (strlen(name) >= sizeof(bus->name))
+    {
+        return 1;
+    }
+    
+    memset(bus, 0, sizeof(amg8833_interface_bus_t));
+    strcpy(bus->name, name);
+    bus->fd = -1;
+    bus->ref = 0;
+    if (pthread_mutex_init(&bus->mutex, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     deinit the bus context
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t amg8833_interface_bus_deinit(amg8833_interface_bus_t *bus)
+{
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    if (bus->ref != 0)
+    {
+        return 1;
+    }
+    
+    if (pthread_mutex_destroy(&bus->mutex) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus init with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the iic device is opened by the first handle on the bus
+ */
+uint8_t amg8833_interface_iic_init_ctx(void *user)
+{
+    amg8833_interface_bus_t *bus = (amg8833_interface_bus_t *)user;
+    uint8_t res;
+    
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    res = 0;
+    (void)pthread_mutex_lock(&bus->mutex);
+    if (bus->ref == 0)
+    {
+        res = iic_init(bus->name, &bus->fd);
+    }
+    if (res == 0)
+    {
+        bus->ref++;
+    }
+    (void)pthread_mutex_unlock(&bus->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief     interface iic bus deinit with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      the iic device is closed by the last handle on the bus
+ */
+uint8_t amg8833_interface_iic_deinit_ctx(void *user)
+{
+    amg8833_interface_bus_t *bus = (amg8833_interface_bus_t *)user;
+    uint8_t res;
+    
+    if (bus == NULL)
+    {
+        return 1;
+    }
+    
+    res = 0;
+    (void)pthread_mutex_lock(&bus->mutex);
+    if (bus->ref == 0)
+    {
+        res = 1;
+    }
+    else if (bus->ref == 1)
+    {
+        res = iic_deinit(bus->fd);
+        if (res == 0)
+        {
+            bus->fd = -1;
+            bus->ref = 0;
+        }
+    }
+    else
+    {
+        bus->ref--;
+    }
+    (void)pthread_mutex_unlock(&bus->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief      interface iic bus read with the user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_interface_bus_t *bus = (amg8833_interface_bus_t *)user;
+    
+    return iic_read(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_interface_bus_t *bus = (amg8833_interface_bus_t *)user;
+    
+    return iic_write(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface receive callback with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] type interrupt type
+ * @note      none
+ */
+void amg8833_interface_receive_callback_ctx(void *user, uint8_t type)
+{
+    (void)user;
+    
+    amg8833_interface_receive_callback(type);
+}
@@ -0,0 +1,479 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_replay.c
+ * @brief     raspberrypi4b_driver amg8833 replay source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_amg8833_replay.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief replay register definition
+ */
+#define AMG8833_REPLAY_REG_RST          0x01        /**< software reset register */
+#define AMG8833_REPLAY_REG_STAT         0x04        /**< status register */
+#define AMG8833_REPLAY_REG_SCLR         0x05        /**< status clear register */
+#define AMG8833_REPLAY_REG_TTHL         0x0E        /**< thermistor lower level register */
+#define AMG8833_REPLAY_REG_TTHH         0x0F        /**< thermistor upper level register */
+#define AMG8833_REPLAY_REG_INT0         0x10        /**< first interrupt result register */
+#define AMG8833_REPLAY_REG_INT7         0x17        /**< last interrupt result register */
+#define AMG8833_REPLAY_REG_T01L         0x80        /**< first pixel register */
+#define AMG8833_REPLAY_PERIOD           100000      /**< plain file frame period in us */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_replay_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     rewind to the first frame
+ * @param[in] *replay pointer to a replay structure
+ * @note      none
+ */
+static void a_replay_rewind(amg8833_replay_t *replay)
+{
+    if (replay->container != 0)
+    {
+        (void)amg8833_record_reader_init(&replay->reader, replay->map, (uint32_t)replay->size);
+    }
+    else
+    {
+        replay->pos = 0;
+    }
+}
+
+/**
+ * @brief      load a frame from the file
+ * @param[in]  *replay pointer to a replay structure
+ * @param[out] *frame pointer to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more frame
+ * @note       frames of the other sensors are skipped, a plain file only holds sensor 0
+ */
+static uint8_t a_replay_load(amg8833_replay_t *replay, amg8833_record_frame_t *frame)
+{
+    if (replay->container != 0)
+    {
+        while (amg8833_record_reader_read(&replay->reader, frame) == 0)
+        {
+            if (frame->sensor == replay->sensor)
+            {
+                return 0;
+            }
+        }
+        
+        return 1;
+    }
+    if ((replay->sensor != 0) || (replay->size - replay->pos < AMG8833_FRAME_BUFFER_SIZE))
+    {
+        return 1;
+    }
+    memcpy(frame->buf, &replay->map[replay->pos], AMG8833_FRAME_BUFFER_SIZE);
+    frame->timestamp = (uint64_t)(replay->pos / AMG8833_FRAME_BUFFER_SIZE) * AMG8833_REPLAY_PERIOD;
+    frame->sensor = 0;
+    frame->status = 0;
+    frame->thermistor = 0;
+    replay->pos += AMG8833_FRAME_BUFFER_SIZE;
+    
+    return 0;
+}
+
+/**
+ * @brief     load the next frame
+ * @param[in] *replay pointer to a replay structure
+ * @note      a looped replay goes on from the first frame
+ */
+static void a_replay_fetch(amg8833_replay_t *replay)
+{
+    replay->next_valid = (a_replay_load(replay, &replay->next) == 0) ? 1 : 0;
+    if ((replay->next_valid == 0) && (replay->loop != 0))
+    {
+        a_replay_rewind(replay);
+        
+        /* a wrapped frame restarts the real time clock */
+        if (a_replay_load(replay, &replay->next) == 0)
+        {
+            replay->next_valid = 2;
+        }
+    }
+}
+
+/**
+ * @brief     serve the next frame
+ * @param[in] *replay pointer to a replay structure
+ * @note      the frame is copied into the register map
+ */
+static void a_replay_advance(amg8833_replay_t *replay)
+{
+    uint16_t thermistor;
+    
+    if (replay->next_valid == 0)
+    {
+        replay->end = 1;
+        
+        return;
+    }
+    if (replay->next_valid == 2)
+    {
+        replay->first = replay->next.timestamp;
+        replay->start = a_replay_now();
+    }
+    memcpy(&replay->frame, &replay->next, sizeof(amg8833_record_frame_t));
+    replay->frames++;
+    
+    /* the thermistor register is 12 bits sign and magnitude */
+    if (replay->frame.thermistor < 0)
+    {
+        thermistor = (uint16_t)(0x800 | ((-replay->frame.thermistor) & 0x7FF));
+    }
+    else
+    {
+        thermistor = (uint16_t)(replay->frame.thermistor & 0x7FF);
+    }
+    replay->reg[AMG8833_REPLAY_REG_STAT] = replay->frame.status;
+    replay->reg[AMG8833_REPLAY_REG_TTHL] = (uint8_t)(thermistor & 0xFF);
+    replay->reg[AMG8833_REPLAY_REG_TTHH] = (uint8_t)(thermistor >> 8);
+    memcpy(&replay->reg[AMG8833_REPLAY_REG_T01L], replay->frame.buf, AMG8833_FRAME_BUFFER_SIZE);
+    a_replay_fetch(replay);
+}
+
+/**
+ * @brief     catch up with the real time clock
+ * @param[in] *replay pointer to a replay structure
+ * @note      none
+ */
+static void a_replay_sync(amg8833_replay_t *replay)
+{
+    uint64_t elapsed;
+    uint64_t due;
+    
+    elapsed = a_replay_now() - replay->start;
+    while (replay->next_valid != 0)
+    {
+        if (replay->next_valid == 2)
+        {
+            due = replay->frame.timestamp - replay->first + AMG8833_REPLAY_PERIOD;
+        }
+        else
+        {
+            due = replay->next.timestamp - replay->first;
+        }
+        if (elapsed < due)
+        {
+            break;
+        }
+        a_replay_advance(replay);
+        if (replay->next_valid == 0)
+        {
+            break;
+        }
+        elapsed = a_replay_now() - replay->start;
+    }
+}
+
+/**
+ * @brief     open a replay
+ * @param[in] *replay pointer to a replay structure
+ * @param[in] *name pointer to a record file or a file of frame buffers
+ * @param[in] sensor served sensor id
+ * @param[in] mode replay mode
+ * @param[in] loop restart from the first frame at the end of the file
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 file is empty
+ * @note      link the replay with DRIVER_AMG8833_LINK_USER and the replay context functions,
+ *            frames of the other sensors are skipped, a plain file only holds sensor 0,
+ *            frames of a plain file are 100 ms apart and have no thermistor or status
+ */
+uint8_t amg8833_replay_open(amg8833_replay_t *replay, const char *name, uint8_t sensor, amg8833_replay_mode_t mode, uint8_t loop)
+{
+    struct stat st;
+    
+    if ((replay == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    
+    /* map the file */
+    memset(replay, 0, sizeof(amg8833_replay_t));
+    replay->fd = open(name, O_RDONLY);
+    if (replay->fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(replay->fd, &st) != 0) || (st.st_size <= 0) || ((uint64_t)st.st_size > 0xFFFFFFFFULL))
+    {
+        (void)close(replay->fd);
+        
+        return 2;
+    }
+    replay->size = (size_t)st.st_size;
+    replay->map = (const uint8_t *)mmap(NULL, replay->size, PROT_READ, MAP_SHARED, replay->fd, 0);
+    if (replay->map == MAP_FAILED)
+    {
+        (void)close(replay->fd);
+        replay->map = NULL;
+        
+        return 1;
+    }
+    
+    /* a record container or plain frame buffers */
+    replay->container = (amg8833_record_reader_init(&replay->reader, replay->map, (uint32_t)replay->size) == 0) ? 1 : 0;
+    replay->sensor = sensor;
+    replay->mode = (uint8_t)mode;
+    replay->loop = loop;
+    a_replay_fetch(replay);
+    if (replay->next_valid == 0)
+    {
+        (void)amg8833_replay_close(replay);
+        
+        return 2;
+    }
+    
+    /* the first frame is served at once */
+    replay->next_valid = 1;
+    replay->first = replay->next.timestamp;
+    replay->start = a_replay_now();
+    a_replay_advance(replay);
+    if (mode == AMG8833_REPLAY_MODE_FAST)
+    {
+        /* counted by the first pixel read */
+        replay->frames = 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close a replay
+ * @param[in] *replay pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t amg8833_replay_close(amg8833_replay_t *replay)
+{
+    if ((replay == NULL) || (replay->map == NULL))
+    {
+        return 1;
+    }
+    
+    (void)munmap((void *)replay->map, replay->size);
+    (void)close(replay->fd);
+    replay->map = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the replay statistics
+ * @param[in]  *replay pointer to a replay structure
+ * @param[out] *frames pointer to a served frame number buffer
+ * @param[out] *reads pointer to a read transaction number buffer
+ * @param[out] *writes pointer to a write transaction number buffer
+ * @param[out] *end pointer to an end of file flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       after the end the last frame is served again
+ */
+uint8_t amg8833_replay_get_statistics(amg8833_replay_t *replay, uint64_t *frames, uint32_t *reads, uint32_t *writes, uint8_t *end)
+{
+    if ((replay == NULL) || (frames == NULL) || (reads == NULL) || (writes == NULL) || (end == NULL))
+    {
+        return 1;
+    }
+    
+    *frames = replay->frames;
+    *reads = replay->reads;
+    *writes = replay->writes;
+    *end = replay->end;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay iic bus init
+ * @param[in] *user pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_replay_iic_init_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay iic bus deinit
+ * @param[in] *user pointer to a replay structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_replay_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief      replay iic bus read
+ * @param[in]  *user pointer to a replay structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the pixel, thermistor and status registers come from the frame file, the others from the register map
+ */
+uint8_t amg8833_replay_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_replay_t *replay = (amg8833_replay_t *)user;
+    
+    (void)addr;
+    if ((replay == NULL) || (replay->map == NULL) || (buf == NULL) || ((uint32_t)reg + len > 256))
+    {
+        return 1;
+    }
+    
+    /* move to the frame of this read */
+    if (replay->mode == AMG8833_REPLAY_MODE_REALTIME)
+    {
+        a_replay_sync(replay);
+    }
+    else if (reg == AMG8833_REPLAY_REG_T01L)
+    {
+        if (replay->frames != 0)
+        {
+            a_replay_advance(replay);
+        }
+        else
+        {
+            replay->frames = 1;
+        }
+    }
+    memcpy(buf, &replay->reg[reg], len);
+    replay->reads++;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay iic bus write
+ * @param[in] *user pointer to a replay structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the initial reset clears the register map, the flag reset and the sclr register clear the status,
+ *            writes to the status, thermistor and interrupt result registers are ignored
+ */
+uint8_t amg8833_replay_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_replay_t *replay = (amg8833_replay_t *)user;
+    uint16_t i;
+    
+    (void)addr;
+    if ((replay == NULL) || (replay->map == NULL) || (buf == NULL) || ((uint32_t)reg + len > AMG8833_REPLAY_REG_T01L))
+    {
+        return 1;
+    }
+    
+    for (i = 0; i < len; i++)
+    {
+        if ((reg + i) == AMG8833_REPLAY_REG_RST)
+        {
+            if (buf[i] == 0x3F)
+            {
+                memset(&replay->reg[0], 0, AMG8833_REPLAY_REG_STAT);
+                memset(&replay->reg[AMG8833_REPLAY_REG_SCLR], 0, AMG8833_REPLAY_REG_TTHL - AMG8833_REPLAY_REG_SCLR);
+            }
+            if ((buf[i] == 0x3F) || (buf[i] == 0x30))
+            {
+                replay->reg[AMG8833_REPLAY_REG_STAT] = 0;
+                memset(&replay->reg[AMG8833_REPLAY_REG_INT0], 0, AMG8833_REPLAY_REG_INT7 - AMG8833_REPLAY_REG_INT0 + 1);
+            }
+        }
+        else if ((reg + i) == AMG8833_REPLAY_REG_SCLR)
+        {
+            replay->reg[AMG8833_REPLAY_REG_STAT] &= (uint8_t)(~buf[i]);
+        }
+        else if (((reg + i) == AMG8833_REPLAY_REG_STAT) || ((reg + i) == AMG8833_REPLAY_REG_TTHL) || 
+                 ((reg + i) == AMG8833_REPLAY_REG_TTHH) || ((reg + i) >= AMG8833_REPLAY_REG_INT0))
+        {
+            /* read only */
+        }
+        else
+        {
+            replay->reg[reg + i] = buf[i];
+        }
+    }
+    replay->writes++;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay delay ms
+ * @param[in] ms time
+ * @note      returns at once for fast replays, link amg8833_interface_delay_ms for real time replays
+ */
+void amg8833_replay_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
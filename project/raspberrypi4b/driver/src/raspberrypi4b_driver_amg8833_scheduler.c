@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_scheduler.c
+ * @brief     raspberrypi4b_driver amg8833 scheduler source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_amg8833_scheduler.h"
+#include <errno.h>
+#include <time.h>
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_scheduler_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     sleep until the deadline
+ * @param[in] deadline absolute monotonic time in ns
+ * @note      none
+ */
+static void a_scheduler_sleep_until(uint64_t deadline)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(deadline / 1000000000ULL);
+    ts.tv_nsec = (long)(deadline % 1000000000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        
+    }
+}
+
+/**
+ * @brief     read one frame into the sensor ring
+ * @param[in] *sensor pointer to a scheduler sensor structure
+ * @note      the frame is read into the ring storage directly
+ */
+static void a_scheduler_poll(amg8833_scheduler_sensor_t *sensor)
+{
+    uint8_t res;
+    amg8833_ring_frame_t *frame;
+    
+    /* skip the bus transfer when the consumer is behind */
+    if (amg8833_ring_acquire(&sensor->ring, &frame) != 0)
+    {
+        return;
+    }
+    
+    /* read the frame, an unchanged frame is not published */
+    res = amg8833_read_temperature_array_buffer(sensor->handle, frame->buf);
+    if (res == 5)
+    {
+        return;
+    }
+    else if (res != 0)
+    {
+        sensor->errors++;
+        
+        return;
+    }
+    else
+    {
+        /* publish the frame */
+        (void)amg8833_ring_commit(&sensor->ring, a_scheduler_now());
+    }
+}
+
+/**
+ * @brief     bus thread
+ * @param[in] *arg pointer to a scheduler bus structure
+ * @return    NULL
+ * @note      the sensors of one bus are read one after another at their own phase,
+ *            so the bus is never shared by two transfers
+ */
+static void *a_scheduler_thread(void *arg)
+{
+    amg8833_scheduler_bus_t *bus = (amg8833_scheduler_bus_t *)arg;
+    amg8833_scheduler_t *scheduler = bus->scheduler;
+    uint64_t cycle;
+    uint64_t now;
+    uint64_t next;
+    uint8_t i;
+    
+    cycle = 0;
+    while (scheduler->running != 0)
+    {
+        /* read every sensor at its phase */
+        for (i = 0; (i < bus->sensor_num) && (scheduler->running != 0); i++)
+        {
+            amg8833_scheduler_sensor_t *sensor = &scheduler->sensor[bus->sensor[i]];
+            
+            a_scheduler_sleep_until(scheduler->start + cycle * scheduler->period + sensor->phase);
+            a_scheduler_poll(sensor);
+        }
+        cycle++;
+        
+        /* skip the missed cycles instead of bursting to catch up */
+        now = a_scheduler_now();
+        if ((scheduler->running != 0) && (now >= scheduler->start + (cycle + 1) * scheduler->period))
+        {
+            next = (now - scheduler->start) / scheduler->period + 1;
+            for (i = 0; i < bus->sensor_num; i++)
+            {
+                scheduler->sensor[bus->sensor[i]].overruns += (uint32_t)(next - cycle);
+            }
+            cycle = next;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     init the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @param[in] period_ms frame period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_init(amg8833_scheduler_t *scheduler, uint32_t period_ms)
+{
+    if ((scheduler == NULL) || (period_ms == 0))
+    {
+        return 1;
+    }
+    
+    memset(scheduler, 0, sizeof(amg8833_scheduler_t));
+    scheduler->period = (uint64_t)period_ms * 1000000ULL;
+    
+    return 0;
+}
+
+/**
+ * @brief     deinit the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_deinit(amg8833_scheduler_t *scheduler)
+{
+    if ((scheduler == NULL) || (scheduler->running != 0))
+    {
+        return 1;
+    }
+    
+    scheduler->sensor_num = 0;
+    scheduler->bus_num = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      add a sensor to the scheduler
+ * @param[in]  *scheduler pointer to a scheduler structure
+ * @param[in]  *handle pointer to an initialized amg8833 handle structure
+ * @param[out] *id pointer to a sensor id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ * @note       none
+ */
+uint8_t amg8833_scheduler_add(amg8833_scheduler_t *scheduler, amg8833_handle_t *handle, uint8_t *id)
+{
+    amg8833_scheduler_sensor_t *sensor;
+    amg8833_scheduler_bus_t *bus;
+    uint8_t i;
+    
+    if ((scheduler == NULL) || (handle == NULL) || (scheduler->running != 0))
+    {
+        return 1;
+    }
+    if (scheduler->sensor_num >= AMG8833_SCHEDULER_MAX_SENSOR)
+    {
+        return 1;
+    }
+    
+    /* find the bus */
+    bus = NULL;
+    for (i = 0; i < scheduler->bus_num; i++)
+    {
+        if (scheduler->bus[i].user == handle->user)
+        {
+            bus = &scheduler->bus[i];
+            
+            break;
+        }
+    }
+    if (bus == NULL)
+    {
+        if (scheduler->bus_num >= AMG8833_SCHEDULER_MAX_BUS)
+        {
+            return 1;
+        }
+        bus = &scheduler->bus[scheduler->bus_num];
+        memset(bus, 0, sizeof(amg8833_scheduler_bus_t));
+        bus->scheduler = scheduler;
+        bus->user = handle->user;
+        scheduler->bus_num++;
+    }
+    
+    /* add the sensor */
+    sensor = &scheduler->sensor[scheduler->sensor_num];
+    memset(sensor, 0, sizeof(amg8833_scheduler_sensor_t));
+    if (amg8833_ring_init(&sensor->ring, sensor->frame, AMG8833_SCHEDULER_RING_SIZE) != 0)
+    {
+        return 1;
+    }
+    sensor->handle = handle;
+    bus->sensor[bus->sensor_num] = scheduler->sensor_num;
+    bus->sensor_num++;
+    *id = scheduler->sensor_num;
+    scheduler->sensor_num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     start the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_start(amg8833_scheduler_t *scheduler)
+{
+    uint8_t i;
+    uint8_t j;
+    
+    if ((scheduler == NULL) || (scheduler->running != 0) || (scheduler->bus_num == 0))
+    {
+        return 1;
+    }
+    
+    /* stagger the sensors of every bus over one period */
+    for (i = 0; i < scheduler->bus_num; i++)
+    {
+        amg8833_scheduler_bus_t *bus = &scheduler->bus[i];
+        
+        for (j = 0; j < bus->sensor_num; j++)
+        {
+            scheduler->sensor[bus->sensor[j]].phase = scheduler->period * j / bus->sensor_num;
+        }
+    }
+    
+    /* start all the bus threads one period later */
+    scheduler->start = a_scheduler_now() + scheduler->period;
+    scheduler->running = 1;
+    for (i = 0; i < scheduler->bus_num; i++)
+    {
+        if (pthread_create(&scheduler->bus[i].thread, NULL, a_scheduler_thread, &scheduler->bus[i]) != 0)
+        {
+            scheduler->running = 0;
+            for (j = 0; j < i; j++)
+            {
+                (void)pthread_join(scheduler->bus[j].thread, NULL);
+            }
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stop the scheduler
+ * @param[in] *scheduler pointer to a scheduler structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t amg8833_scheduler_stop(amg8833_scheduler_t *scheduler)
+{
+    uint8_t i;
+    
+    if ((scheduler == NULL) || (scheduler->running == 0))
+    {
+        return 1;
+    }
+    
+    scheduler->running = 0;
+    for (i = 0; i < scheduler->bus_num; i++)
+    {
+        (void)pthread_join(scheduler->bus[i].thread, NULL);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         read the frames of a sensor
+ * @param[in]     *scheduler pointer to a scheduler structure
+ * @param[in]     id sensor id
+ * @param[out]    *frame pointer to a frame array
+ * @param[in,out] *len pointer to a frame number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no frame
+ *                - 2 id is invalid
+ * @note          none
+ */
+uint8_t amg8833_scheduler_read(amg8833_scheduler_t *scheduler, uint8_t id, amg8833_ring_frame_t *frame, uint32_t *len)
+{
+    if ((scheduler == NULL) || (id >= scheduler->sensor_num))
+    {
+        return 2;
+    }
+    
+    return amg8833_ring_read(&scheduler->sensor[id].ring, frame, len);
+}
+
+/**
+ * @brief      get the sensor statistics
+ * @param[in]  *scheduler pointer to a scheduler structure
+ * @param[in]  id sensor id
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @param[out] *errors pointer to a read error number buffer
+ * @param[out] *overruns pointer to a missed deadline number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 id is invalid
+ * @note       none
+ */
+uint8_t amg8833_scheduler_get_statistics(amg8833_scheduler_t *scheduler, uint8_t id,
+                                         uint32_t *dropped, uint32_t *errors, uint32_t *overruns)
+{
+    amg8833_scheduler_sensor_t *sensor;
+    
+    if ((scheduler == NULL) || (id >= scheduler->sensor_num))
+    {
+        return 2;
+    }
+    
+    sensor = &scheduler->sensor[id];
+    (void)amg8833_ring_get_dropped(&sensor->ring, dropped);
+    *errors = sensor->errors;
+    *overruns = sensor->overruns;
+    
+    return 0;
+}
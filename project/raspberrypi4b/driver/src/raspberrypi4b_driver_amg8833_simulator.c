@@ -0,0 +1,571 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_amg8833_simulator.c
+ * @brief     raspberrypi4b_driver amg8833 simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_amg8833_simulator.h"
+
+/**
+ * @brief simulator register definition
+ */
+#define AMG8833_SIMULATOR_REG_PCTL         0x00        /**< power control register */
+#define AMG8833_SIMULATOR_REG_RST          0x01        /**< software reset register */
+#define AMG8833_SIMULATOR_REG_FPSC         0x02        /**< frame rate register */
+#define AMG8833_SIMULATOR_REG_INTC         0x03        /**< interrupt function register */
+#define AMG8833_SIMULATOR_REG_STAT         0x04        /**< status register */
+#define AMG8833_SIMULATOR_REG_SCLR         0x05        /**< status clear register */
+#define AMG8833_SIMULATOR_REG_AVE          0x07        /**< moving average register */
+#define AMG8833_SIMULATOR_REG_INTHL        0x08        /**< interrupt upper value lower level register */
+#define AMG8833_SIMULATOR_REG_INTHH        0x09        /**< interrupt upper value upper level register */
+#define AMG8833_SIMULATOR_REG_INTLL        0x0A        /**< interrupt lower value lower level register */
+#define AMG8833_SIMULATOR_REG_INTLH        0x0B        /**< interrupt lower value upper level register */
+#define AMG8833_SIMULATOR_REG_IHYSL        0x0C        /**< interrupt hysteresis lower level register */
+#define AMG8833_SIMULATOR_REG_IHYSH        0x0D        /**< interrupt hysteresis upper level register */
+#define AMG8833_SIMULATOR_REG_TTHL         0x0E        /**< thermistor lower level register */
+#define AMG8833_SIMULATOR_REG_TTHH         0x0F        /**< thermistor upper level register */
+#define AMG8833_SIMULATOR_REG_INT0         0x10        /**< first interrupt result register */
+#define AMG8833_SIMULATOR_REG_T01L         0x80        /**< first pixel register */
+
+/**
+ * @brief simulator status bit definition
+ */
+#define AMG8833_SIMULATOR_STAT_INTF        (1 << 1)        /**< interrupt outbreak */
+#define AMG8833_SIMULATOR_STAT_OVF_IRS     (1 << 2)        /**< temperature output overflow */
+#define AMG8833_SIMULATOR_STAT_OVF_THS     (1 << 3)        /**< thermistor output overflow */
+
+/**
+ * @brief     default scene
+ * @param[in] *user pointer to a scene context
+ * @param[in] time_us scene time in us
+ * @param[out] *pixel pointer to a pixel array
+ * @param[out] *thermistor pointer to a thermistor buffer
+ * @note      a 32C body of 2 x 2 pixels crosses the rows 3 and 4 one column every 500 ms
+ */
+static void a_simulator_scene(void *user, uint64_t time_us, int16_t pixel[64], int16_t *thermistor)
+{
+    int32_t col;
+    uint8_t i, j;
+    
+    (void)user;
+    col = (int32_t)((time_us / 500000) % 12) - 2;
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            if (((i == 3) || (i == 4)) && (((int32_t)j == col) || ((int32_t)j == col + 1)))
+            {
+                pixel[i * 8 + j] = 128;
+            }
+            else if (((i >= 2) && (i <= 5)) && ((int32_t)j >= col - 1) && ((int32_t)j <= col + 2))
+            {
+                pixel[i * 8 + j] = 104;
+            }
+            else
+            {
+                pixel[i * 8 + j] = 88;
+            }
+        }
+    }
+    *thermistor = 400;
+}
+
+/**
+ * @brief     get a 12 bits level register
+ * @param[in] *reg pointer to the lower level register
+ * @return    level
+ * @note      none
+ */
+static int16_t a_simulator_level(const uint8_t *reg)
+{
+    uint16_t v;
+    
+    v = (uint16_t)(((uint16_t)(reg[1] & 0x0F) << 8) | reg[0]);
+    
+    return (int16_t)((v ^ 0x800) - 0x800);
+}
+
+/**
+ * @brief     get the frame period
+ * @param[in] *simulator pointer to a simulator structure
+ * @return    period in us, 0 means no frame
+ * @note      none
+ */
+static uint64_t a_simulator_period(amg8833_simulator_t *simulator)
+{
+    switch (simulator->reg[AMG8833_SIMULATOR_REG_PCTL])
+    {
+        case AMG8833_MODE_NORMAL :
+        {
+            return ((simulator->reg[AMG8833_SIMULATOR_REG_FPSC] & 0x01) != 0) ? 1000000 : 100000;
+        }
+        case AMG8833_MODE_STAND_BY_60S :
+        {
+            return 60000000;
+        }
+        case AMG8833_MODE_STAND_BY_10S :
+        {
+            return 10000000;
+        }
+        default :
+        {
+            return 0;
+        }
+    }
+}
+
+/**
+ * @brief     sample a frame
+ * @param[in] *simulator pointer to a simulator structure
+ * @note      none
+ */
+static void a_simulator_frame(amg8833_simulator_t *simulator)
+{
+    int16_t pixel[64];
+    int16_t thermistor;
+    int16_t high, low, hysteresis;
+    int32_t v;
+    uint64_t hi, lo;
+    uint8_t i;
+    
+    /* sample the scene with the sensor noise */
+    simulator->scene(simulator->user, simulator->now, pixel, &thermistor);
+    for (i = 0; i < 64; i++)
+    {
+        v = pixel[i];
+        if (simulator->seed != 0)
+        {
+            simulator->seed = simulator->seed * 1103515245U + 12345U;
+            v += (int32_t)((simulator->seed >> 16) % 3) - 1;
+        }
+        
+        /* twice moving average outputs the mean of the last two samples */
+        if (((simulator->reg[AMG8833_SIMULATOR_REG_AVE] & (1 << 5)) != 0) && (simulator->frames != 0))
+        {
+            int32_t s = v;
+            
+            v = (v + simulator->sample[i]) / 2;
+            simulator->sample[i] = (int16_t)s;
+        }
+        else
+        {
+            simulator->sample[i] = (int16_t)v;
+        }
+        if ((v > 2047) || (v < -2048))
+        {
+            v = (v > 2047) ? 2047 : -2048;
+            simulator->reg[AMG8833_SIMULATOR_REG_STAT] |= AMG8833_SIMULATOR_STAT_OVF_IRS;
+        }
+        pixel[i] = (int16_t)v;
+    }
+    if ((thermistor > 2047) || (thermistor < -2047))
+    {
+        thermistor = (thermistor > 0) ? 2047 : -2047;
+        simulator->reg[AMG8833_SIMULATOR_REG_STAT] |= AMG8833_SIMULATOR_STAT_OVF_THS;
+    }
+    
+    /* interrupt with hysteresis in the absolute or the difference mode */
+    high = a_simulator_level(&simulator->reg[AMG8833_SIMULATOR_REG_INTHL]);
+    low = a_simulator_level(&simulator->reg[AMG8833_SIMULATOR_REG_INTLL]);
+    hysteresis = a_simulator_level(&simulator->reg[AMG8833_SIMULATOR_REG_IHYSL]);
+    hi = 0;
+    lo = 0;
+    for (i = 0; i < 64; i++)
+    {
+        if ((simulator->reg[AMG8833_SIMULATOR_REG_INTC] & (1 << 1)) != 0)
+        {
+            v = pixel[i];
+        }
+        else
+        {
+            v = (simulator->frames != 0) ? (pixel[i] - simulator->out[i]) : 0;
+        }
+        if ((v > high) || ((((simulator->high >> i) & 1) != 0) && (v > high - hysteresis)))
+        {
+            hi |= 1ULL << i;
+        }
+        if ((v < low) || ((((simulator->low >> i) & 1) != 0) && (v < low + hysteresis)))
+        {
+            lo |= 1ULL << i;
+        }
+    }
+    simulator->high = hi;
+    simulator->low = lo;
+    for (i = 0; i < 8; i++)
+    {
+        simulator->reg[AMG8833_SIMULATOR_REG_INT0 + i] = (uint8_t)((hi | lo) >> (i * 8));
+    }
+    if (((hi | lo) != 0) && ((simulator->reg[AMG8833_SIMULATOR_REG_INTC] & (1 << 0)) != 0))
+    {
+        simulator->reg[AMG8833_SIMULATOR_REG_STAT] |= AMG8833_SIMULATOR_STAT_INTF;
+    }
+    
+    /* output registers */
+    for (i = 0; i < 64; i++)
+    {
+        simulator->out[i] = pixel[i];
+        simulator->reg[AMG8833_SIMULATOR_REG_T01L + i * 2 + 0] = (uint8_t)(pixel[i] & 0xFF);
+        simulator->reg[AMG8833_SIMULATOR_REG_T01L + i * 2 + 1] = (uint8_t)((pixel[i] >> 8) & 0x0F);
+    }
+    if (thermistor < 0)
+    {
+        thermistor = (int16_t)(0x800 | (-thermistor));
+    }
+    simulator->reg[AMG8833_SIMULATOR_REG_TTHL] = (uint8_t)(thermistor & 0xFF);
+    simulator->reg[AMG8833_SIMULATOR_REG_TTHH] = (uint8_t)((thermistor >> 8) & 0x0F);
+    simulator->frames++;
+}
+
+/**
+ * @brief     reset the flags
+ * @param[in] *simulator pointer to a simulator structure
+ * @note      none
+ */
+static void a_simulator_flag_reset(amg8833_simulator_t *simulator)
+{
+    simulator->reg[AMG8833_SIMULATOR_REG_STAT] = 0;
+    memset(&simulator->reg[AMG8833_SIMULATOR_REG_INT0], 0, 8);
+    simulator->high = 0;
+    simulator->low = 0;
+}
+
+/**
+ * @brief     init the simulator
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] seed noise seed
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the sensor starts in the normal mode at 10 fps with the first frame ready,
+ *            the default scene is a warm body walking across a 22C room
+ */
+uint8_t amg8833_simulator_init(amg8833_simulator_t *simulator, uint32_t seed)
+{
+    if (simulator == NULL)
+    {
+        return 1;
+    }
+    
+    memset(simulator, 0, sizeof(amg8833_simulator_t));
+    simulator->seed = seed;
+    simulator->scene = a_simulator_scene;
+    a_simulator_frame(simulator);
+    simulator->next = a_simulator_period(simulator);
+    
+    return 0;
+}
+
+/**
+ * @brief     set the scene
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] scene scene function, NULL restores the default scene
+ * @param[in] *user pointer to a scene context
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+uint8_t amg8833_simulator_set_scene(amg8833_simulator_t *simulator, amg8833_simulator_scene_t scene, void *user)
+{
+    if (simulator == NULL)
+    {
+        return 1;
+    }
+    
+    simulator->scene = (scene != NULL) ? scene : a_simulator_scene;
+    simulator->user = user;
+    
+    return 0;
+}
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] *simulator pointer to a simulator structure
+ * @param[in] us time in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 advance failed
+ * @note      every frame due in the time is sampled, averaged and checked for interrupts
+ */
+uint8_t amg8833_simulator_advance(amg8833_simulator_t *simulator, uint32_t us)
+{
+    uint64_t target;
+    uint64_t period;
+    
+    if (simulator == NULL)
+    {
+        return 1;
+    }
+    
+    target = simulator->now + us;
+    period = a_simulator_period(simulator);
+    while ((period != 0) && (simulator->next <= target))
+    {
+        simulator->now = simulator->next;
+        a_simulator_frame(simulator);
+        simulator->next += period;
+    }
+    if (period == 0)
+    {
+        /* no frame while sleeping */
+        simulator->next = target;
+    }
+    simulator->now = target;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the int pin
+ * @param[in]  *simulator pointer to a simulator structure
+ * @param[out] *level pointer to a level buffer, 1 means the active low pin is asserted
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_get_int_pin(amg8833_simulator_t *simulator, uint8_t *level)
+{
+    if ((simulator == NULL) || (level == NULL))
+    {
+        return 1;
+    }
+    
+    *level = (((simulator->reg[AMG8833_SIMULATOR_REG_INTC] & (1 << 0)) != 0) && 
+              ((simulator->reg[AMG8833_SIMULATOR_REG_STAT] & AMG8833_SIMULATOR_STAT_INTF) != 0)) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the bus statistics
+ * @param[in]  *simulator pointer to a simulator structure
+ * @param[out] *reads pointer to a read transaction number buffer
+ * @param[out] *writes pointer to a write transaction number buffer
+ * @param[out] *read_bytes pointer to a read byte number buffer
+ * @param[out] *write_bytes pointer to a write byte number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_get_statistics(amg8833_simulator_t *simulator, uint32_t *reads, uint32_t *writes,
+                                         uint64_t *read_bytes, uint64_t *write_bytes)
+{
+    if ((simulator == NULL) || (reads == NULL) || (writes == NULL) || (read_bytes == NULL) || (write_bytes == NULL))
+    {
+        return 1;
+    }
+    
+    *reads = simulator->reads;
+    *writes = simulator->writes;
+    *read_bytes = simulator->read_bytes;
+    *write_bytes = simulator->write_bytes;
+    
+    return 0;
+}
+
+/**
+ * @brief     clear the bus statistics
+ * @param[in] *simulator pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 clear failed
+ * @note      none
+ */
+uint8_t amg8833_simulator_clear_statistics(amg8833_simulator_t *simulator)
+{
+    if (simulator == NULL)
+    {
+        return 1;
+    }
+    
+    simulator->reads = 0;
+    simulator->writes = 0;
+    simulator->read_bytes = 0;
+    simulator->write_bytes = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator iic bus init
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_simulator_iic_init_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator iic bus deinit
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_simulator_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  *user pointer to a simulator structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_simulator_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_simulator_t *simulator = (amg8833_simulator_t *)user;
+    
+    (void)addr;
+    if ((simulator == NULL) || (buf == NULL) || ((uint32_t)reg + len > 256))
+    {
+        return 1;
+    }
+    
+    memcpy(buf, &simulator->reg[reg], len);
+    simulator->reads++;
+    simulator->read_bytes += len;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] *user pointer to a simulator structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      read only registers ignore the write
+ */
+uint8_t amg8833_simulator_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    amg8833_simulator_t *simulator = (amg8833_simulator_t *)user;
+    uint16_t i;
+    uint8_t r;
+    
+    (void)addr;
+    if ((simulator == NULL) || (buf == NULL) || ((uint32_t)reg + len > 256))
+    {
+        return 1;
+    }
+    
+    for (i = 0; i < len; i++)
+    {
+        r = (uint8_t)(reg + i);
+        switch (r)
+        {
+            case AMG8833_SIMULATOR_REG_RST :
+            {
+                if (buf[i] == AMG8833_RESET_TYPE_INIT)
+                {
+                    /* the initial reset restores every setting */
+                    memset(&simulator->reg[AMG8833_SIMULATOR_REG_PCTL], 0, AMG8833_SIMULATOR_REG_TTHL);
+                    simulator->frames = 0;
+                    simulator->next = simulator->now + a_simulator_period(simulator);
+                    a_simulator_flag_reset(simulator);
+                }
+                else if (buf[i] == AMG8833_RESET_TYPE_FLAG)
+                {
+                    a_simulator_flag_reset(simulator);
+                }
+                else
+                {
+                    return 1;
+                }
+                
+                break;
+            }
+            case AMG8833_SIMULATOR_REG_SCLR :
+            {
+                simulator->reg[AMG8833_SIMULATOR_REG_STAT] &= (uint8_t)(~buf[i] & 0x0E);
+                
+                break;
+            }
+            case AMG8833_SIMULATOR_REG_PCTL :
+            case AMG8833_SIMULATOR_REG_FPSC :
+            {
+                simulator->reg[r] = buf[i];
+                simulator->next = simulator->now + a_simulator_period(simulator);
+                
+                break;
+            }
+            case AMG8833_SIMULATOR_REG_INTC :
+            case AMG8833_SIMULATOR_REG_AVE :
+            case AMG8833_SIMULATOR_REG_INTHL :
+            case AMG8833_SIMULATOR_REG_INTLL :
+            case AMG8833_SIMULATOR_REG_IHYSL :
+            {
+                simulator->reg[r] = buf[i];
+                
+                break;
+            }
+            case AMG8833_SIMULATOR_REG_INTHH :
+            case AMG8833_SIMULATOR_REG_INTLH :
+            case AMG8833_SIMULATOR_REG_IHYSH :
+            {
+                simulator->reg[r] = buf[i] & 0x0F;
+                
+                break;
+            }
+            default :
+            {
+                /* read only */
+                break;
+            }
+        }
+    }
+    simulator->writes++;
+    simulator->write_bytes += len;
+    
+    return 0;
+}
@@ -0,0 +1,478 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     simulator main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_read_test.h"
+#include "driver_amg8833_register_test.h"
+#include "driver_amg8833_interrupt_test.h"
+#include "driver_amg8833_algorithm_test.h"
+#include "raspberrypi4b_driver_amg8833_simulator.h"
+#include "raspberrypi4b_driver_amg8833_archive.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+uint8_t (*g_simulator_irq)(void) = NULL;        /**< simulated irq */
+extern amg8833_simulator_t g_simulator;         /**< simulated sensor */
+extern uint32_t g_simulator_error;              /**< printed error lines */
+
+/**
+ * @brief archive test definition
+ */
+#define SIMULATOR_ARCHIVE_FRAMES        5000        /**< frames of every sensor */
+
+/**
+ * @brief     record append callback
+ * @param[in] *user pointer to a file
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_simulator_record_write(void *user, const uint8_t *data, uint32_t len)
+{
+    return (fwrite(data, 1, len, (FILE *)user) == len) ? 0 : 1;
+}
+
+/**
+ * @brief     write a generated frame
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] sensor sensor id
+ * @param[in] k frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      sensor s takes frame k at k ms + s * 500 us, pixel j is k * 7 + j + s * 100
+ */
+static uint8_t a_simulator_archive_frame(amg8833_record_writer_t *writer, uint8_t sensor, uint32_t k)
+{
+    amg8833_record_frame_t frame;
+    uint16_t v;
+    uint8_t j;
+    
+    for (j = 0; j < 64; j++)
+    {
+        v = (uint16_t)((k * 7 + j + sensor * 100) & 0x7FF);
+        frame.buf[j * 2 + 0] = (uint8_t)(v & 0xFF);
+        frame.buf[j * 2 + 1] = (uint8_t)(v >> 8);
+    }
+    frame.timestamp = (uint64_t)k * 1000 + sensor * 500;
+    frame.sensor = sensor;
+    frame.status = 0;
+    frame.thermistor = 400;
+    
+    return amg8833_record_writer_write(writer, &frame);
+}
+
+/**
+ * @brief  archive test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   two sensors are recorded with sensor 1 written 3 frames late, the archive must sort them
+ *         over several runs and merge passes and every seek must land on the first frame at or after the timestamp
+ */
+static uint8_t a_simulator_archive_test(void)
+{
+    static amg8833_record_writer_t writer;
+    static amg8833_archive_t archive;
+    amg8833_archive_cursor_t cursor;
+    const amg8833_archive_entry_t *entry;
+    char record_name[64];
+    char archive_name[64];
+    uint64_t prev;
+    uint64_t t;
+    uint64_t expect;
+    uint64_t e0;
+    uint64_t e1;
+    uint32_t i;
+    uint32_t k;
+    uint8_t sensor;
+    uint8_t res;
+    FILE *fp;
+    
+    amg8833_interface_debug_print("amg8833: archive test.\n");
+    (void)snprintf(record_name, sizeof(record_name), "/tmp/amg8833_simulator_%d.amgr", (int)getpid());
+    (void)snprintf(archive_name, sizeof(archive_name), "/tmp/amg8833_simulator_%d.amga", (int)getpid());
+    
+    /* generate the record */
+    fp = fopen(record_name, "wb");
+    if (fp == NULL)
+    {
+        amg8833_interface_debug_print("amg8833: open %s failed.\n", record_name);
+        
+        return 1;
+    }
+    res = amg8833_record_writer_init(&writer, AMG8833_RECORD_ENCODING_DELTA, 64, a_simulator_record_write, fp, 0);
+    for (k = 0; (k < SIMULATOR_ARCHIVE_FRAMES + 3) && (res == 0); k++)
+    {
+        if (k < SIMULATOR_ARCHIVE_FRAMES)
+        {
+            res = a_simulator_archive_frame(&writer, 0, k);
+        }
+        if ((k >= 3) && (res == 0))
+        {
+            res = a_simulator_archive_frame(&writer, 1, k - 3);
+        }
+    }
+    if ((fclose(fp) != 0) || (res != 0))
+    {
+        amg8833_interface_debug_print("amg8833: write %s failed.\n", record_name);
+        (void)remove(record_name);
+        
+        return 1;
+    }
+    
+    /* build and open the archive */
+    res = amg8833_archive_build(record_name, archive_name);
+    (void)remove(record_name);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: archive build failed.\n");
+        
+        return 1;
+    }
+    res = amg8833_archive_open(&archive, archive_name);
+    (void)remove(archive_name);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: archive open failed.\n");
+        
+        return 1;
+    }
+    if ((archive.frames != SIMULATOR_ARCHIVE_FRAMES * 2) || (archive.first != 0) || 
+        (archive.last != (uint64_t)(SIMULATOR_ARCHIVE_FRAMES - 1) * 1000 + 500) || 
+        (archive.index_num[0] != SIMULATOR_ARCHIVE_FRAMES) || (archive.index_num[1] != SIMULATOR_ARCHIVE_FRAMES))
+    {
+        amg8833_interface_debug_print("amg8833: archive has %d frames from %lld us to %lld us.\n", archive.frames,
+                                      (long long)archive.first, (long long)archive.last);
+        (void)amg8833_archive_close(&archive);
+        
+        return 1;
+    }
+    
+    /* the entries are sorted */
+    prev = 0;
+    (void)amg8833_archive_seek(&archive, AMG8833_ARCHIVE_ANY_SENSOR, 0, &cursor);
+    for (i = 0; amg8833_archive_next(&archive, &cursor, &entry) == 0; i++)
+    {
+        if (entry->timestamp < prev)
+        {
+            amg8833_interface_debug_print("amg8833: archive entry %d is not sorted.\n", i);
+            (void)amg8833_archive_close(&archive);
+            
+            return 1;
+        }
+        prev = entry->timestamp;
+    }
+    
+    /* every seek lands on the first frame at or after the timestamp */
+    for (t = 0; t <= (uint64_t)SIMULATOR_ARCHIVE_FRAMES * 1000 + 250; t += 250)
+    {
+        for (sensor = 0; sensor < 3; sensor++)
+        {
+            /* sensor 2 is any sensor, the earliest of sensor 0 and 1 */
+            e0 = (t + 999) / 1000 * 1000;
+            e1 = (t <= 500) ? 500 : ((t - 500 + 999) / 1000 * 1000 + 500);
+            e0 = (e0 > (uint64_t)(SIMULATOR_ARCHIVE_FRAMES - 1) * 1000) ? UINT64_MAX : e0;
+            e1 = (e1 > (uint64_t)(SIMULATOR_ARCHIVE_FRAMES - 1) * 1000 + 500) ? UINT64_MAX : e1;
+            expect = (sensor == 0) ? e0 : ((sensor == 1) ? e1 : ((e0 < e1) ? e0 : e1));
+            res = amg8833_archive_seek(&archive, (sensor == 2) ? AMG8833_ARCHIVE_ANY_SENSOR : sensor, t, &cursor);
+            if (res == 0)
+            {
+                res = amg8833_archive_next(&archive, &cursor, &entry);
+            }
+            if (expect == UINT64_MAX)
+            {
+                res = (res == 0) ? 1 : 0;
+            }
+            else if ((res == 0) && ((entry->timestamp != expect) || 
+                     (AMG8833_FRAME_PIXEL(entry->buf, 0) != (int16_t)(((expect / 1000) * 7 + entry->sensor * 100) & 0x7FF))))
+            {
+                res = 1;
+            }
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: archive seek sensor %d to %lld us failed.\n", sensor, (long long)t);
+                (void)amg8833_archive_close(&archive);
+                
+                return 1;
+            }
+        }
+    }
+    (void)amg8833_archive_close(&archive);
+    amg8833_interface_debug_print("amg8833: archive of %d frames checked.\n", SIMULATOR_ARCHIVE_FRAMES * 2);
+    
+    return 0;
+}
+
+/**
+ * @brief     amg8833 simulator function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      the tests run on the simulated sensor and the simulated time
+ */
+uint8_t amg8833_simulator(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "ht:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"test", required_argument, NULL, 't'},
+        {"mode", required_argument, NULL, 1},
+        {"seed", required_argument, NULL, 2},
+        {"times", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+    char type[33] = "unknown";
+    uint32_t times = 3;
+    uint32_t seed = 1;
+    amg8833_interrupt_mode_t mode = AMG8833_INTERRUPT_MODE_ABSOLUTE;
+    uint32_t reads, writes;
+    uint64_t read_bytes, write_bytes;
+    struct timespec start, stop;
+    double wall;
+    uint8_t res;
+    
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* interrupt mode */
+            case 1 :
+            {
+                /* set the interrupt mode */
+                if (strcmp("ABS", optarg) == 0)
+                {
+                    mode = AMG8833_INTERRUPT_MODE_ABSOLUTE;
+                }
+                else if (strcmp("DIFF", optarg) == 0)
+                {
+                    mode = AMG8833_INTERRUPT_MODE_DIFFERENCE;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* noise seed */
+            case 2 :
+            {
+                /* set the seed */
+                seed = (uint32_t)strtoul(optarg, NULL, 0);
+                
+                break;
+            }
+            
+            /* running times */
+            case 3 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* the simulated sensor powers on with the first frame ready */
+    (void)amg8833_simulator_init(&g_simulator, seed);
+    g_simulator_error = 0;
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        /* run reg test */
+        res = amg8833_register_test(AMG8833_ADDRESS_0);
+    }
+    else if (strcmp("t_read", type) == 0)
+    {
+        /* run read test */
+        res = amg8833_read_test(AMG8833_ADDRESS_0, times);
+    }
+    else if (strcmp("t_int", type) == 0)
+    {
+        /* run interrupt test with the simulated int pin */
+        g_simulator_irq = amg8833_interrupt_test_irq_handler;
+        res = amg8833_interrupt_test(AMG8833_ADDRESS_0, mode, 30.0f, 25.0f, 28.0f, times);
+        g_simulator_irq = NULL;
+    }
+    else if (strcmp("t_algorithm", type) == 0)
+    {
+        /* run algorithm test */
+        res = amg8833_algorithm_test();
+    }
+    else if (strcmp("t_archive", type) == 0)
+    {
+        /* run archive test */
+        res = a_simulator_archive_test();
+    }
+    else if (strcmp("h", type) == 0)
+    {
+        help:
+        amg8833_interface_debug_print("Usage:\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-h | --help)\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-t reg | --test=reg) [--seed=<num>]\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-t read | --test=read) [--seed=<num>] [--times=<num>]\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-t int | --test=int) [--seed=<num>] [--times=<num>] [--mode=<ABS | DIFF>]\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-t algorithm | --test=algorithm)\n");
+        amg8833_interface_debug_print("  amg8833_simulator (-t archive | --test=archive)\n");
+        amg8833_interface_debug_print("\n");
+        amg8833_interface_debug_print("Options:\n");
+        amg8833_interface_debug_print("  -h, --help                             Show the help.\n");
+        amg8833_interface_debug_print("      --mode=<ABS | DIFF>                Set the interrupt mode.([default: ABS])\n");
+        amg8833_interface_debug_print("      --seed=<num>                       Set the sensor noise seed, 0 disables the noise.([default: 1])\n");
+        amg8833_interface_debug_print("  -t <reg | read | int | algorithm | archive>, --test=<reg | read | int | algorithm | archive>\n");
+        amg8833_interface_debug_print("                                         Run the driver test on the simulated sensor.\n");
+        amg8833_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
+        
+        return 0;
+    }
+    else
+    {
+        return 5;
+    }
+    
+    /* the wall time of the driver against the simulated time */
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+    wall = (double)(stop.tv_sec - start.tv_sec) * 1000000.0 + (double)(stop.tv_nsec - start.tv_nsec) / 1000.0;
+    (void)amg8833_simulator_get_statistics(&g_simulator, &reads, &writes, &read_bytes, &write_bytes);
+    amg8833_interface_debug_print("amg8833: simulated %0.3fs and %d frames in %0.3fms.\n",
+                                  (double)g_simulator.now / 1000000.0, g_simulator.frames, wall / 1000.0);
+    amg8833_interface_debug_print("amg8833: %d reads of %lld bytes and %d writes of %lld bytes, %0.3fus per transaction.\n",
+                                  reads, (long long)read_bytes, writes, (long long)write_bytes,
+                                  ((reads + writes) != 0) ? (wall / (double)(reads + writes)) : 0.0);
+    if ((res != 0) || (g_simulator_error != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    uint8_t res;
+
+    res = amg8833_simulator(argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        amg8833_interface_debug_print("amg8833: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        amg8833_interface_debug_print("amg8833: param is invalid.\n");
+    }
+    else
+    {
+        amg8833_interface_debug_print("amg8833: unknown status code.\n");
+    }
+
+    return res;
+}
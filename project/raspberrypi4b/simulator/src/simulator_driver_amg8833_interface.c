@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      simulator_driver_amg8833_interface.c
+ * @brief     simulator driver amg8833 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_interface.h"
+#include "raspberrypi4b_driver_amg8833_simulator.h"
+#include <stdarg.h>
+
+/**
+ * @brief simulated sensor definition
+ */
+amg8833_simulator_t g_simulator;        /**< simulated sensor */
+
+/**
+ * @brief simulated irq definition
+ */
+extern uint8_t (*g_simulator_irq)(void);
+
+/**
+ * @brief simulated error counter definition
+ */
+uint32_t g_simulator_error = 0;        /**< printed error lines */
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t amg8833_interface_iic_init(void)
+{
+    return amg8833_simulator_iic_init_ctx(&g_simulator);
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t amg8833_interface_iic_deinit(void)
+{
+    return amg8833_simulator_iic_deinit_ctx(&g_simulator);
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return amg8833_simulator_iic_read_ctx(&g_simulator, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return amg8833_simulator_iic_write_ctx(&g_simulator, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the simulated time runs 1 ms per step and the falling edge of the int pin calls the irq
+ */
+void amg8833_interface_delay_ms(uint32_t ms)
+{
+    uint8_t prev;
+    uint8_t level;
+    
+    while (ms != 0)
+    {
+        (void)amg8833_simulator_get_int_pin(&g_simulator, &prev);
+        (void)amg8833_simulator_advance(&g_simulator, 1000);
+        (void)amg8833_simulator_get_int_pin(&g_simulator, &level);
+        if ((prev == 0) && (level != 0) && (g_simulator_irq != NULL))
+        {
+            (void)g_simulator_irq();
+        }
+        ms--;
+    }
+}
+
+/**
+ * @brief  interface get the timestamp in us
+ * @return timestamp
+ * @note   the timestamp is the simulated time and wraps around
+ */
+uint32_t amg8833_interface_timestamp_us(void)
+{
+    return (uint32_t)g_simulator.now;
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      lines reporting an error are counted
+ */
+void amg8833_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    if (strstr(str, "error") != NULL)
+    {
+        g_simulator_error++;
+    }
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+void amg8833_interface_receive_callback(uint8_t type)
+{
+    switch (type)
+    {
+        case AMG8833_STATUS_OVF_THS :
+        {
+            amg8833_interface_debug_print("amg8833: irq thermistor temperature output overflow.\n");
+            
+            break;
+        }
+        case AMG8833_STATUS_OVF_IRS :
+        {
+            amg8833_interface_debug_print("amg8833: irq temperature output overflow.\n");
+            
+            break;
+        }
+        case AMG8833_STATUS_INTF :
+        {
+            amg8833_interface_debug_print("amg8833: irq interrupt outbreak.\n");
+            
+            break;
+        }
+        default :
+        {
+            amg8833_interface_debug_print("amg8833: unknown code.\n");
+            
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     interface iic bus init with the user context
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_init_ctx(void *user)
+{
+    return amg8833_simulator_iic_init_ctx(user);
+}
+
+/**
+ * @brief     interface iic bus deinit with the user context
+ * @param[in] *user pointer to a simulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_deinit_ctx(void *user)
+{
+    return amg8833_simulator_iic_deinit_ctx(user);
+}
+
+/**
+ * @brief      interface iic bus read with the user context
+ * @param[in]  *user pointer to a simulator structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t amg8833_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return amg8833_simulator_iic_read_ctx(user, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user context
+ * @param[in] *user pointer to a simulator structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t amg8833_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return amg8833_simulator_iic_write_ctx(user, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface receive callback with the user context
+ * @param[in] *user pointer to a simulator structure
+ * @param[in] type interrupt type
+ * @note      none
+ */
+void amg8833_interface_receive_callback_ctx(void *user, uint8_t type)
+{
+    (void)user;
+    
+    amg8833_interface_receive_callback(type);
+}
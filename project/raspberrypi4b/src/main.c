@@ -37,15 +37,109 @@
 #include "driver_amg8833_read_test.h"
 #include "driver_amg8833_register_test.h"
 #include "driver_amg8833_interrupt_test.h"
+#include "driver_amg8833_algorithm_test.h"
 #include "driver_amg8833_basic.h"
 #include "driver_amg8833_interrupt.h"
+#include "driver_amg8833_decode.h"
+#include "driver_amg8833_counter.h"
+#include "driver_amg8833_record.h"
+#include "raspberrypi4b_driver_amg8833_scheduler.h"
+#include "raspberrypi4b_driver_amg8833_archive.h"
+#include "raspberrypi4b_driver_amg8833_replay.h"
+#include "raspberrypi4b_driver_amg8833_interface.h"
 #include "gpio.h"
 #include "mutex.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
 
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
 
+/**
+ * @brief     record append callback
+ * @param[in] *user pointer to a file
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      every record is flushed to the disk before the next one
+ */
+static uint8_t a_record_write(void *user, const uint8_t *data, uint32_t len)
+{
+    FILE *fp = (FILE *)user;
+    
+    if (fwrite(data, 1, len, fp) != len)
+    {
+        return 1;
+    }
+    if (fflush(fp) != 0)
+    {
+        return 1;
+    }
+    if (fsync(fileno(fp)) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      load a whole file
+ * @param[in]  *name pointer to a file name
+ * @param[out] **data pointer to a data pointer, free it after use
+ * @param[out] *len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ * @note       none
+ */
+static uint8_t a_load_file(const char *name, uint8_t **data, uint32_t *len)
+{
+    FILE *fp;
+    long size;
+    
+    fp = fopen(name, "rb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    if ((fseek(fp, 0, SEEK_END) != 0) || ((size = ftell(fp)) < 0) || (fseek(fp, 0, SEEK_SET) != 0))
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    
+    /* the record offsets are 32 bits */
+    if ((uint64_t)size > AMG8833_RECORD_MAX_FILE_SIZE)
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    *data = (uint8_t *)malloc((size_t)size + 1);
+    if (*data == NULL)
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    if (fread(*data, 1, (size_t)size, fp) != (size_t)size)
+    {
+        free(*data);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    *len = (uint32_t)size;
+    (void)fclose(fp);
+    
+    return 0;
+}
+
 /**
  * @brief     interface receive callback
  * @param[in] type interrupt type
@@ -141,6 +235,9 @@ uint8_t amg8833(uint8_t argc, char **argv)
         {"low-threshold", required_argument, NULL, 4},
         {"mode", required_argument, NULL, 5},
         {"times", required_argument, NULL, 6},
+        {"bus", required_argument, NULL, 7},
+        {"file", required_argument, NULL, 8},
+        {"sensor", required_argument, NULL, 9},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
@@ -150,6 +247,10 @@ uint8_t amg8833(uint8_t argc, char **argv)
     float high_threshold = 30.0f;
     float low_threshold = 25.0f;
     float hysteresis_level = 28.0f;
+    char bus_name[AMG8833_SCHEDULER_MAX_BUS][32];
+    uint8_t bus_num = 0;
+    char file_name[256] = {0};
+    uint8_t sensor = 0;
     
     /* if no params */
     if (argc == 1)
@@ -296,6 +397,40 @@ uint8_t amg8833(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* bus */
+            case 7 :
+            {
+                /* add the bus */
+                if (bus_num >= AMG8833_SCHEDULER_MAX_BUS)
+                {
+                    return 5;
+                }
+                memset(bus_name[bus_num], 0, sizeof(char) * 32);
+                snprintf(bus_name[bus_num], 32, "%s", optarg);
+                bus_num++;
+                
+                break;
+            }
+            
+            /* file */
+            case 8 :
+            {
+                /* set the file */
+                memset(file_name, 0, sizeof(char) * 256);
+                snprintf(file_name, 256, "%s", optarg);
+                
+                break;
+            }
+            
+            /* sensor */
+            case 9 :
+            {
+                /* set the sensor */
+                sensor = (uint8_t)atol(optarg);
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -335,6 +470,18 @@ uint8_t amg8833(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_algorithm", type) == 0)
+    {
+        /* run algorithm test */
+        if (amg8833_algorithm_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("t_int", type) == 0)
     {
         /* set gpio irq */
@@ -370,6 +517,7 @@ uint8_t amg8833(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i, j, k;
+        uint32_t frames, duplicates, dropped;
         
         /* init */
         res = amg8833_basic_init(addr);
@@ -387,8 +535,8 @@ uint8_t amg8833(uint8_t argc, char **argv)
             float temp[8][8];
             float tmp;
             
-            /* read temperature array */
-            res = amg8833_basic_read_temperature_array(temp);
+            /* read the next new temperature array */
+            res = amg8833_basic_read_temperature_array_sync(temp);
             if (res != 0)
             {
                 amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
@@ -420,9 +568,13 @@ uint8_t amg8833(uint8_t argc, char **argv)
             
             /* output */
             amg8833_interface_debug_print("amg8833: temperature is %0.3fC.\n", tmp);
-            
-            /* delay 1000 ms */
-            amg8833_interface_delay_ms(1000);
+        }
+        
+        /* output the statistics */
+        res = amg8833_basic_get_statistics(&frames, &duplicates, &dropped);
+        if (res == 0)
+        {
+            amg8833_interface_debug_print("amg8833: frames %d duplicates %d dropped %d.\n", frames, duplicates, dropped);
         }
         
         /* deinit */
@@ -496,6 +648,540 @@ uint8_t amg8833(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_poll", type) == 0)
+    {
+        static amg8833_interface_bus_t bus[AMG8833_SCHEDULER_MAX_BUS];
+        static amg8833_handle_t handle[AMG8833_SCHEDULER_MAX_BUS][2];
+        static amg8833_scheduler_t scheduler;
+        amg8833_ring_frame_t frame[AMG8833_SCHEDULER_RING_SIZE];
+        uint8_t res;
+        uint8_t id;
+        uint8_t i, j;
+        uint32_t k;
+        
+        /* default bus */
+        if (bus_num == 0)
+        {
+            snprintf(bus_name[0], 32, "/dev/i2c-1");
+            bus_num = 1;
+        }
+        
+        /* init the scheduler with 100 ms period */
+        res = amg8833_scheduler_init(&scheduler, 100);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: scheduler init failed.\n");
+            
+            return 1;
+        }
+        
+        /* probe both addresses on every bus */
+        for (i = 0; i < bus_num; i++)
+        {
+            res = amg8833_interface_bus_init(&bus[i], bus_name[i]);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: bus init failed.\n");
+                
+                return 1;
+            }
+            for (j = 0; j < 2; j++)
+            {
+                DRIVER_AMG8833_LINK_INIT(&handle[i][j], amg8833_handle_t);
+                DRIVER_AMG8833_LINK_IIC_INIT_CTX(&handle[i][j], amg8833_interface_iic_init_ctx);
+                DRIVER_AMG8833_LINK_IIC_DEINIT_CTX(&handle[i][j], amg8833_interface_iic_deinit_ctx);
+                DRIVER_AMG8833_LINK_IIC_READ_CTX(&handle[i][j], amg8833_interface_iic_read_ctx);
+                DRIVER_AMG8833_LINK_IIC_WRITE_CTX(&handle[i][j], amg8833_interface_iic_write_ctx);
+                DRIVER_AMG8833_LINK_RECEIVE_CALLBACK_CTX(&handle[i][j], amg8833_interface_receive_callback_ctx);
+                DRIVER_AMG8833_LINK_DELAY_MS(&handle[i][j], amg8833_interface_delay_ms);
+                DRIVER_AMG8833_LINK_DEBUG_PRINT(&handle[i][j], amg8833_interface_debug_print);
+                DRIVER_AMG8833_LINK_USER(&handle[i][j], &bus[i]);
+                if (amg8833_basic_handle_init(&handle[i][j], (j == 0) ? AMG8833_ADDRESS_0 : AMG8833_ADDRESS_1) != 0)
+                {
+                    continue;
+                }
+                res = amg8833_scheduler_add(&scheduler, &handle[i][j], &id);
+                if (res != 0)
+                {
+                    (void)amg8833_basic_handle_deinit(&handle[i][j]);
+                    
+                    continue;
+                }
+                amg8833_interface_debug_print("amg8833: sensor %d is %s addr %d.\n", id, bus_name[i], j);
+            }
+        }
+        
+        /* start */
+        res = amg8833_scheduler_start(&scheduler);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: scheduler start failed.\n");
+        }
+        else
+        {
+            /* loop */
+            for (k = 0; k < times; k++)
+            {
+                /* delay 1000 ms */
+                amg8833_interface_delay_ms(1000);
+                
+                /* output the newest frame of every sensor */
+                for (id = 0; id < scheduler.sensor_num; id++)
+                {
+                    uint32_t dropped, errors, overruns;
+                    uint32_t num = AMG8833_SCHEDULER_RING_SIZE;
+                    
+                    if (amg8833_scheduler_read(&scheduler, id, frame, &num) == 0)
+                    {
+                        amg8833_interface_debug_print("amg8833: sensor %d frame %d center is %0.2fC.\n", id, frame[num - 1].sequence,
+                                                      (float)AMG8833_FRAME_PIXEL_AT(frame[num - 1].buf, 3, 3) * 0.25f);
+                    }
+                    (void)amg8833_scheduler_get_statistics(&scheduler, id, &dropped, &errors, &overruns);
+                    amg8833_interface_debug_print("amg8833: sensor %d frames %d dropped %d errors %d overruns %d.\n", id, num,
+                                                  dropped, errors, overruns);
+                }
+            }
+            
+            /* stop */
+            (void)amg8833_scheduler_stop(&scheduler);
+        }
+        
+        /* deinit */
+        for (i = 0; i < bus_num; i++)
+        {
+            for (j = 0; j < 2; j++)
+            {
+                if (handle[i][j].inited != 0)
+                {
+                    (void)amg8833_basic_handle_deinit(&handle[i][j]);
+                }
+            }
+            (void)amg8833_interface_bus_deinit(&bus[i]);
+        }
+        (void)amg8833_scheduler_deinit(&scheduler);
+        
+        return res;
+    }
+    else if (strcmp("e_count", type) == 0)
+    {
+        static amg8833_counter_t counter;
+        static amg8833_handle_t handle;
+        amg8833_counter_config_t config;
+        int16_t raw[8][8];
+        float temp[8][8];
+        uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];
+        uint32_t in, out;
+        uint32_t last_in, last_out;
+        uint32_t frames;
+        uint8_t res;
+        
+        /* init the counter */
+        (void)amg8833_counter_get_default_config(&config);
+        res = amg8833_counter_init(&counter, &config);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: counter init failed.\n");
+            
+            return 1;
+        }
+        last_in = 0;
+        last_out = 0;
+        frames = 0;
+        
+        if (file_name[0] != 0)
+        {
+            static amg8833_record_reader_t reader;
+            amg8833_record_frame_t frame;
+            uint8_t *data;
+            uint32_t len;
+            uint32_t pos;
+            
+            /* load the recorded file */
+            if (a_load_file(file_name, &data, &len) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: open %s failed.\n", file_name);
+                
+                return 1;
+            }
+            
+            /* a record container or plain frame buffers */
+            res = amg8833_record_reader_init(&reader, data, len);
+            pos = 0;
+            while (1)
+            {
+                if (res == 0)
+                {
+                    if (amg8833_record_reader_read(&reader, &frame) != 0)
+                    {
+                        break;
+                    }
+                    
+                    /* only count the chosen sensor */
+                    if (frame.sensor != sensor)
+                    {
+                        continue;
+                    }
+                    memcpy(buf, frame.buf, AMG8833_FRAME_BUFFER_SIZE);
+                }
+                else
+                {
+                    if ((sensor != 0) || ((len - pos) < AMG8833_FRAME_BUFFER_SIZE))
+                    {
+                        break;
+                    }
+                    memcpy(buf, &data[pos], AMG8833_FRAME_BUFFER_SIZE);
+                    pos += AMG8833_FRAME_BUFFER_SIZE;
+                }
+                (void)amg8833_decode_frames(buf, 1, AMG8833_ORIENTATION_IDENTITY, AMG8833_DECODE_FORMAT_RAW, raw);
+                (void)amg8833_counter_update(&counter, (const int16_t (*)[8])raw);
+                (void)amg8833_counter_get_count(&counter, &in, &out);
+                if ((in != last_in) || (out != last_out))
+                {
+                    amg8833_interface_debug_print("amg8833: frame %d in %d out %d.\n", frames, in, out);
+                    last_in = in;
+                    last_out = out;
+                }
+                frames++;
+            }
+            if ((res == 0) && (reader.corrupt != 0))
+            {
+                amg8833_interface_debug_print("amg8833: %d corrupt records skipped.\n", reader.corrupt);
+            }
+            free(data);
+        }
+        else
+        {
+            /* link the live sensor */
+            DRIVER_AMG8833_LINK_INIT(&handle, amg8833_handle_t);
+            DRIVER_AMG8833_LINK_IIC_INIT(&handle, amg8833_interface_iic_init);
+            DRIVER_AMG8833_LINK_IIC_DEINIT(&handle, amg8833_interface_iic_deinit);
+            DRIVER_AMG8833_LINK_IIC_READ(&handle, amg8833_interface_iic_read);
+            DRIVER_AMG8833_LINK_IIC_WRITE(&handle, amg8833_interface_iic_write);
+            DRIVER_AMG8833_LINK_DELAY_MS(&handle, amg8833_interface_delay_ms);
+            DRIVER_AMG8833_LINK_DEBUG_PRINT(&handle, amg8833_interface_debug_print);
+            DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&handle, amg8833_interface_receive_callback);
+            res = amg8833_basic_handle_init(&handle, addr);
+            if (res != 0)
+            {
+                return 1;
+            }
+            
+            /* 10 frames per second */
+            for (frames = 0; frames < times * 10; frames++)
+            {
+                res = amg8833_read_temperature_array(&handle, raw, temp);
+                if (res != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+                    (void)amg8833_basic_handle_deinit(&handle);
+                    
+                    return 1;
+                }
+                (void)amg8833_counter_update(&counter, (const int16_t (*)[8])raw);
+                (void)amg8833_counter_get_count(&counter, &in, &out);
+                if ((in != last_in) || (out != last_out))
+                {
+                    amg8833_interface_debug_print("amg8833: frame %d in %d out %d.\n", frames, in, out);
+                    last_in = in;
+                    last_out = out;
+                }
+                amg8833_interface_delay_ms(100);
+            }
+            (void)amg8833_basic_handle_deinit(&handle);
+        }
+        
+        /* output the counts */
+        (void)amg8833_counter_get_count(&counter, &in, &out);
+        amg8833_interface_debug_print("amg8833: %d frames in %d out %d.\n", frames, in, out);
+        
+        return 0;
+    }
+    else if (strcmp("e_record", type) == 0)
+    {
+        static amg8833_record_writer_t writer;
+        static amg8833_record_reader_t reader;
+        static amg8833_handle_t handle;
+        amg8833_record_frame_t frame;
+        amg8833_snapshot_t snapshot;
+        uint8_t *data;
+        uint32_t len;
+        uint32_t end;
+        uint32_t frames;
+        uint32_t last;
+        uint32_t now;
+        uint64_t timestamp;
+        uint8_t i;
+        uint8_t res;
+        FILE *fp;
+        
+        /* check the file */
+        if (file_name[0] == 0)
+        {
+            amg8833_interface_debug_print("amg8833: no record file.\n");
+            
+            return 5;
+        }
+        
+        /* cut a record left over by a power loss and go on after the last frame */
+        end = 0;
+        timestamp = 0;
+        if (a_load_file(file_name, &data, &len) == 0)
+        {
+            if (amg8833_record_reader_init(&reader, data, len) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: %s is not a record file.\n", file_name);
+                free(data);
+                
+                return 1;
+            }
+            while (amg8833_record_reader_read(&reader, &frame) == 0)
+            {
+                timestamp = frame.timestamp + 100000;
+            }
+            (void)amg8833_record_reader_get_end(&reader, &end);
+            free(data);
+            if ((end != len) && (truncate(file_name, end) != 0))
+            {
+                amg8833_interface_debug_print("amg8833: truncate %s failed.\n", file_name);
+                
+                return 1;
+            }
+        }
+        fp = fopen(file_name, "ab");
+        if (fp == NULL)
+        {
+            amg8833_interface_debug_print("amg8833: open %s failed.\n", file_name);
+            
+            return 1;
+        }
+        res = amg8833_record_writer_init(&writer, AMG8833_RECORD_ENCODING_DELTA, 600, a_record_write, fp, end);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: record init failed.\n");
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        
+        /* link the live sensor */
+        DRIVER_AMG8833_LINK_INIT(&handle, amg8833_handle_t);
+        DRIVER_AMG8833_LINK_IIC_INIT(&handle, amg8833_interface_iic_init);
+        DRIVER_AMG8833_LINK_IIC_DEINIT(&handle, amg8833_interface_iic_deinit);
+        DRIVER_AMG8833_LINK_IIC_READ(&handle, amg8833_interface_iic_read);
+        DRIVER_AMG8833_LINK_IIC_WRITE(&handle, amg8833_interface_iic_write);
+        DRIVER_AMG8833_LINK_DELAY_MS(&handle, amg8833_interface_delay_ms);
+        DRIVER_AMG8833_LINK_DEBUG_PRINT(&handle, amg8833_interface_debug_print);
+        DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&handle, amg8833_interface_receive_callback);
+        res = amg8833_basic_handle_init(&handle, addr);
+        if (res != 0)
+        {
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        
+        /* 10 frames per second */
+        last = amg8833_interface_timestamp_us();
+        for (frames = 0; frames < times * 10; frames++)
+        {
+            now = amg8833_interface_timestamp_us();
+            timestamp += (uint32_t)(now - last);
+            last = now;
+            frame.timestamp = timestamp;
+            frame.sensor = 0;
+            
+            /* the snapshot gives the signed thermistor of the record */
+            res = amg8833_read_snapshot(&handle, &snapshot);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: read frame failed.\n");
+                (void)amg8833_basic_handle_deinit(&handle);
+                (void)fclose(fp);
+                
+                return 1;
+            }
+            frame.status = snapshot.status;
+            frame.thermistor = snapshot.thermistor;
+            
+            /* back to the 12 bits register order of the identity orientation */
+            for (i = 0; i < 64; i++)
+            {
+                frame.buf[(63 - i) * 2 + 0] = (uint8_t)(snapshot.raw[i / 8][i % 8] & 0xFF);
+                frame.buf[(63 - i) * 2 + 1] = (uint8_t)((snapshot.raw[i / 8][i % 8] >> 8) & 0x0F);
+            }
+            res = amg8833_record_writer_write(&writer, &frame);
+            if (res == 5)
+            {
+                amg8833_interface_debug_print("amg8833: %s reaches 4 GiB, record to a new file.\n", file_name);
+                (void)amg8833_basic_handle_deinit(&handle);
+                (void)fclose(fp);
+                
+                return 1;
+            }
+            else if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: write record failed.\n");
+                (void)amg8833_basic_handle_deinit(&handle);
+                (void)fclose(fp);
+                
+                return 1;
+            }
+            amg8833_interface_delay_ms(100);
+        }
+        (void)amg8833_basic_handle_deinit(&handle);
+        (void)fclose(fp);
+        
+        /* output the size */
+        amg8833_interface_debug_print("amg8833: %d frames recorded, file size %d bytes.\n", frames, writer.offset);
+        
+        return 0;
+    }
+    else if (strcmp("e_archive", type) == 0)
+    {
+        static amg8833_archive_t archive;
+        amg8833_archive_cursor_t cursor;
+        const amg8833_archive_entry_t *entry;
+        char archive_name[300];
+        int16_t raw[8][8];
+        uint64_t middle;
+        uint8_t i;
+        
+        /* check the file */
+        if (file_name[0] == 0)
+        {
+            amg8833_interface_debug_print("amg8833: no record file.\n");
+            
+            return 5;
+        }
+        
+        /* build the archive next to the record file */
+        (void)snprintf(archive_name, 300, "%s.amga", file_name);
+        if (amg8833_archive_build(file_name, archive_name) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: build %s failed.\n", archive_name);
+            
+            return 1;
+        }
+        if (amg8833_archive_open(&archive, archive_name) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: open %s failed.\n", archive_name);
+            
+            return 1;
+        }
+        
+        /* output the index */
+        amg8833_interface_debug_print("amg8833: %s has %d frames from %llu us to %llu us.\n", archive_name,
+                                      archive.frames, (unsigned long long)archive.first, (unsigned long long)archive.last);
+        middle = archive.first + (archive.last - archive.first) / 2;
+        for (i = 0; i < AMG8833_RECORD_MAX_SENSOR; i++)
+        {
+            if (archive.index_num[i] == 0)
+            {
+                continue;
+            }
+            
+            /* seek every sensor to the middle of the archive */
+            (void)amg8833_archive_seek(&archive, i, middle, &cursor);
+            if (amg8833_archive_next(&archive, &cursor, &entry) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: sensor %d has %d frames.\n", i, archive.index_num[i]);
+                
+                continue;
+            }
+            (void)amg8833_decode_frames(entry->buf, 1, AMG8833_ORIENTATION_IDENTITY, AMG8833_DECODE_FORMAT_RAW, raw);
+            amg8833_interface_debug_print("amg8833: sensor %d has %d frames, center at %llu us is %0.2fC.\n", i,
+                                          archive.index_num[i], (unsigned long long)entry->timestamp, (float)raw[3][3] * 0.25f);
+        }
+        (void)amg8833_archive_close(&archive);
+        
+        return 0;
+    }
+    else if (strcmp("e_replay", type) == 0)
+    {
+        static amg8833_replay_t replay;
+        static amg8833_counter_t counter;
+        static amg8833_handle_t handle;
+        amg8833_counter_config_t config;
+        struct timespec start, stop;
+        int16_t raw[8][8];
+        float temp[8][8];
+        uint64_t frames;
+        uint32_t reads, writes;
+        uint32_t in, out;
+        uint8_t end;
+        uint8_t res;
+        double s;
+        
+        /* check the file */
+        if (file_name[0] == 0)
+        {
+            amg8833_interface_debug_print("amg8833: no record file.\n");
+            
+            return 5;
+        }
+        
+        /* serve the file as fast as possible */
+        res = amg8833_replay_open(&replay, file_name, sensor, AMG8833_REPLAY_MODE_FAST, 0);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: open %s failed.\n", file_name);
+            
+            return 1;
+        }
+        (void)amg8833_counter_get_default_config(&config);
+        (void)amg8833_counter_init(&counter, &config);
+        
+        /* link the replay */
+        DRIVER_AMG8833_LINK_INIT(&handle, amg8833_handle_t);
+        DRIVER_AMG8833_LINK_IIC_INIT_CTX(&handle, amg8833_replay_iic_init_ctx);
+        DRIVER_AMG8833_LINK_IIC_DEINIT_CTX(&handle, amg8833_replay_iic_deinit_ctx);
+        DRIVER_AMG8833_LINK_IIC_READ_CTX(&handle, amg8833_replay_iic_read_ctx);
+        DRIVER_AMG8833_LINK_IIC_WRITE_CTX(&handle, amg8833_replay_iic_write_ctx);
+        DRIVER_AMG8833_LINK_DELAY_MS(&handle, amg8833_replay_delay_ms);
+        DRIVER_AMG8833_LINK_DEBUG_PRINT(&handle, amg8833_interface_debug_print);
+        DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&handle, amg8833_interface_receive_callback);
+        DRIVER_AMG8833_LINK_USER(&handle, &replay);
+        res = amg8833_basic_handle_init(&handle, addr);
+        if (res != 0)
+        {
+            (void)amg8833_replay_close(&replay);
+            
+            return 1;
+        }
+        
+        /* run the driver and the counter on every frame */
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+        while (1)
+        {
+            res = amg8833_read_temperature_array(&handle, raw, temp);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+                (void)amg8833_basic_handle_deinit(&handle);
+                (void)amg8833_replay_close(&replay);
+                
+                return 1;
+            }
+            (void)amg8833_replay_get_statistics(&replay, &frames, &reads, &writes, &end);
+            if (end != 0)
+            {
+                break;
+            }
+            (void)amg8833_counter_update(&counter, (const int16_t (*)[8])raw);
+        }
+        (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+        (void)amg8833_basic_handle_deinit(&handle);
+        (void)amg8833_replay_close(&replay);
+        
+        /* output the statistics */
+        s = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1000000000.0;
+        (void)amg8833_counter_get_count(&counter, &in, &out);
+        amg8833_interface_debug_print("amg8833: %d frames in %d out %d.\n", (uint32_t)frames, in, out);
+        amg8833_interface_debug_print("amg8833: %d reads %d writes, %0.0f frames per second.\n", reads, writes,
+                                      (s > 0.0) ? ((double)frames / s) : 0.0);
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -507,14 +1193,23 @@ uint8_t amg8833(uint8_t argc, char **argv)
         amg8833_interface_debug_print("  amg8833 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>]\n");
         amg8833_interface_debug_print("  amg8833 (-t int | --test=int) [--addr=<0 | 1>] [--times=<num>] [--mode=<ABS | DIFF>]\n");
         amg8833_interface_debug_print("          [--high-threshold=<high>] [--low-threshold=<low>] [--hysteresis-level=<hysteresis>]\n");
+        amg8833_interface_debug_print("  amg8833 (-t algorithm | --test=algorithm)\n");
         amg8833_interface_debug_print("  amg8833 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>]\n");
         amg8833_interface_debug_print("  amg8833 (-e int | --example=int) [--addr=<0 | 1>] [--times=<num>] [--mode=<ABS | DIFF>]\n");
         amg8833_interface_debug_print("          [--high-threshold=<high>] [--low-threshold=<low>] [--hysteresis-level=<hysteresis>]\n");
+        amg8833_interface_debug_print("  amg8833 (-e poll | --example=poll) [--bus=<dev>]... [--times=<num>]\n");
+        amg8833_interface_debug_print("  amg8833 (-e count | --example=count) [--addr=<0 | 1>] [--times=<num>] [--file=<path>] [--sensor=<id>]\n");
+        amg8833_interface_debug_print("  amg8833 (-e record | --example=record) [--addr=<0 | 1>] [--times=<num>] --file=<path>\n");
+        amg8833_interface_debug_print("  amg8833 (-e archive | --example=archive) --file=<path>\n");
+        amg8833_interface_debug_print("  amg8833 (-e replay | --example=replay) --file=<path> [--sensor=<id>]\n");
         amg8833_interface_debug_print("\n");
         amg8833_interface_debug_print("Options:\n");
         amg8833_interface_debug_print("      --addr=<0 | 1>                     Set the chip iic address.([default: 0])\n");
-        amg8833_interface_debug_print("  -e <read | int>, --example=<read | int>\n");
+        amg8833_interface_debug_print("      --bus=<dev>                        Add an iic bus for the poll example.([default: /dev/i2c-1])\n");
+        amg8833_interface_debug_print("  -e <read | int | poll | count | record | archive | replay>,\n");
+        amg8833_interface_debug_print("      --example=<read | int | poll | count | record | archive | replay>\n");
         amg8833_interface_debug_print("                                         Run the driver example.\n");
+        amg8833_interface_debug_print("      --file=<path>                      Set the record file, count, archive and replay read it and record appends to it.\n");
         amg8833_interface_debug_print("  -h, --help                             Show the help.\n");
         amg8833_interface_debug_print("      --high-threshold=<high>            Set the interrupt high threshold.([default: 30.0f])\n");
         amg8833_interface_debug_print("      --hysteresis-level=<hysteresis>    Set the hysteresis level.([default: 28.0f])\n");
@@ -522,7 +1217,8 @@ uint8_t amg8833(uint8_t argc, char **argv)
         amg8833_interface_debug_print("  -i, --information                      Show the chip information.\n");
         amg8833_interface_debug_print("      --mode=<ABS | DIFF>                Set the interrupt mode.([default: ABS])\n");
         amg8833_interface_debug_print("  -p, --port                             Display the pin connections of the current board.\n");
-        amg8833_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+        amg8833_interface_debug_print("      --sensor=<id>                      Set the sensor of the record file for count and replay.([default: 0])\n");
+        amg8833_interface_debug_print("  -t <reg | read | int | algorithm>, --test=<reg | read | int | algorithm>\n");
         amg8833_interface_debug_print("                                         Run the driver test.\n");
         amg8833_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
         
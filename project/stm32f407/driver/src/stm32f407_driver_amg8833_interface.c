@@ -118,6 +118,42 @@ void amg8833_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief timestamp counter definition
+ */
+static uint8_t gs_timestamp_inited = 0;        /**< cycle counter enabled flag */
+static uint32_t gs_timestamp_last = 0;         /**< last cycle counter value */
+static uint64_t gs_timestamp_cycles = 0;       /**< elapsed cycles */
+
+/**
+ * @brief  interface get the timestamp in us
+ * @return timestamp
+ * @note   the timestamp wraps around at 32 bits and has 1 us resolution,
+ *         it counts the dwt cycle counter which must be read at least once per wrap (25 s at 168 MHz)
+ */
+uint32_t amg8833_interface_timestamp_us(void)
+{
+    uint32_t now;
+    
+    /* enable the cycle counter */
+    if (gs_timestamp_inited == 0)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        gs_timestamp_last = 0;
+        gs_timestamp_cycles = 0;
+        gs_timestamp_inited = 1;
+    }
+    
+    /* extend the 32 bits counter so the us timestamp wraps at 32 bits */
+    now = DWT->CYCCNT;
+    gs_timestamp_cycles += (uint32_t)(now - gs_timestamp_last);
+    gs_timestamp_last = now;
+    
+    return (uint32_t)(gs_timestamp_cycles / (SystemCoreClock / 1000000U));
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -173,3 +209,84 @@ void amg8833_interface_receive_callback(uint8_t type)
         }
     }
 }
+
+/**
+ * @brief     interface iic bus init with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      only one iic bus is used, the user context is ignored
+ */
+uint8_t amg8833_interface_iic_init_ctx(void *user)
+{
+    (void)user;
+    
+    return amg8833_interface_iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with the user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      only one iic bus is used, the user context is ignored
+ */
+uint8_t amg8833_interface_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return amg8833_interface_iic_deinit();
+}
+
+/**
+ * @brief      interface iic bus read with the user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       only one iic bus is used, the user context is ignored
+ */
+uint8_t amg8833_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return amg8833_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      only one iic bus is used, the user context is ignored
+ */
+uint8_t amg8833_interface_iic_write_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return amg8833_interface_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface receive callback with the user context
+ * @param[in] *user pointer to a user context
+ * @param[in] type interrupt type
+ * @note      only one iic bus is used, the user context is ignored
+ */
+void amg8833_interface_receive_callback_ctx(void *user, uint8_t type)
+{
+    (void)user;
+    
+    amg8833_interface_receive_callback(type);
+}
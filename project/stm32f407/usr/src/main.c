@@ -37,6 +37,7 @@
 #include "driver_amg8833_read_test.h"
 #include "driver_amg8833_register_test.h"
 #include "driver_amg8833_interrupt_test.h"
+#include "driver_amg8833_algorithm_test.h"
 #include "driver_amg8833_basic.h"
 #include "driver_amg8833_interrupt.h"
 #include "shell.h"
@@ -367,6 +368,18 @@ uint8_t amg8833(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_algorithm", type) == 0)
+    {
+        /* run algorithm test */
+        if (amg8833_algorithm_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("t_int", type) == 0)
     {
         /* set gpio irq */
@@ -402,6 +415,7 @@ uint8_t amg8833(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i, j, k;
+        uint32_t frames, duplicates, dropped;
         
         /* init */
         res = amg8833_basic_init(addr);
@@ -419,8 +433,8 @@ uint8_t amg8833(uint8_t argc, char **argv)
             float temp[8][8];
             float tmp;
             
-            /* read temperature array */
-            res = amg8833_basic_read_temperature_array(temp);
+            /* read the next new temperature array */
+            res = amg8833_basic_read_temperature_array_sync(temp);
             if (res != 0)
             {
                 amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
@@ -452,9 +466,13 @@ uint8_t amg8833(uint8_t argc, char **argv)
             
             /* output */
             amg8833_interface_debug_print("amg8833: temperature is %0.3fC.\n", tmp);
-            
-            /* delay 1000 ms */
-            amg8833_interface_delay_ms(1000);
+        }
+        
+        /* output the statistics */
+        res = amg8833_basic_get_statistics(&frames, &duplicates, &dropped);
+        if (res == 0)
+        {
+            amg8833_interface_debug_print("amg8833: frames %d duplicates %d dropped %d.\n", frames, duplicates, dropped);
         }
         
         /* deinit */
@@ -539,6 +557,7 @@ uint8_t amg8833(uint8_t argc, char **argv)
         amg8833_interface_debug_print("  amg8833 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>]\n");
         amg8833_interface_debug_print("  amg8833 (-t int | --test=int) [--addr=<0 | 1>] [--times=<num>] [--mode=<ABS | DIFF>]\n");
         amg8833_interface_debug_print("          [--high-threshold=<high>] [--low-threshold=<low>] [--hysteresis-level=<hysteresis>]\n");
+        amg8833_interface_debug_print("  amg8833 (-t algorithm | --test=algorithm)\n");
         amg8833_interface_debug_print("  amg8833 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>]\n");
         amg8833_interface_debug_print("  amg8833 (-e int | --example=int) [--addr=<0 | 1>] [--times=<num>] [--mode=<ABS | DIFF>]\n");
         amg8833_interface_debug_print("          [--high-threshold=<high>] [--low-threshold=<low>] [--hysteresis-level=<hysteresis>]\n");
@@ -554,7 +573,7 @@ uint8_t amg8833(uint8_t argc, char **argv)
         amg8833_interface_debug_print("  -i, --information                      Show the chip information.\n");
         amg8833_interface_debug_print("      --mode=<ABS | DIFF>                Set the interrupt mode.([default: ABS])\n");
         amg8833_interface_debug_print("  -p, --port                             Display the pin connections of the current board.\n");
-        amg8833_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+        amg8833_interface_debug_print("  -t <reg | read | int | algorithm>, --test=<reg | read | int | algorithm>\n");
         amg8833_interface_debug_print("                                         Run the driver test.\n");
         amg8833_interface_debug_print("      --times=<num>                      Set the running times.([default: 3])\n");
         
@@ -78,7 +78,57 @@
 #define AMG8833_REG_T01H         0x81        /**< pixel 1 output value upper level register */
 
 /**
- * @brief      read bytes
+ * @brief register cache definition
+ */
+#define AMG8833_CACHE_MASK       0x3F8D      /**< pctl, fpsc, intc, ave and inthl to ihysh */
+
+/**
+ * @brief frame acquisition definition
+ */
+#define AMG8833_ACQUIRE_PROBE    8           /**< probe the frame boundary every 8 frames */
+
+/**
+ * @brief     init the iic bus
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_amg8833_bus_init(amg8833_handle_t *handle)
+{
+    if (handle->iic_init_ctx != NULL)                        /* check the context function */
+    {
+        return handle->iic_init_ctx(handle->user);           /* init with the context */
+    }
+    else
+    {
+        return handle->iic_init();                           /* init */
+    }
+}
+
+/**
+ * @brief     deinit the iic bus
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+static uint8_t a_amg8833_bus_deinit(amg8833_handle_t *handle)
+{
+    if (handle->iic_deinit_ctx != NULL)                      /* check the context function */
+    {
+        return handle->iic_deinit_ctx(handle->user);         /* deinit with the context */
+    }
+    else
+    {
+        return handle->iic_deinit();                         /* deinit */
+    }
+}
+
+/**
+ * @brief      read bytes from the iic bus
  * @param[in]  *handle pointer to an amg8833 handle structure
  * @param[in]  reg iic register address
  * @param[out] *data pointer to a data buffer
@@ -88,15 +138,171 @@
  *             - 1 read failed
  * @note       none
  */
+static uint8_t a_amg8833_bus_read(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+    
+    if (handle->iic_read_ctx != NULL)                                                 /* check the context function */
+    {
+        res = handle->iic_read_ctx(handle->user, handle->iic_addr, reg, data, len);   /* read with the context */
+    }
+    else
+    {
+        res = handle->iic_read(handle->iic_addr, reg, data, len);                     /* read the register */
+    }
+    if (res != 0)                                                                     /* check result */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     write bytes to the iic bus
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_amg8833_bus_write(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+    
+    if (handle->iic_write_ctx != NULL)                                                 /* check the context function */
+    {
+        res = handle->iic_write_ctx(handle->user, handle->iic_addr, reg, data, len);   /* write with the context */
+    }
+    else
+    {
+        res = handle->iic_write(handle->iic_addr, reg, data, len);                     /* write the register */
+    }
+    if (res != 0)                                                                      /* check result */
+    {
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     run the receive callback
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_amg8833_receive_callback(amg8833_handle_t *handle, uint8_t type)
+{
+    if (handle->receive_callback_ctx != NULL)                  /* check the context function */
+    {
+        handle->receive_callback_ctx(handle->user, type);      /* run callback with the context */
+    }
+    else if (handle->receive_callback != NULL)                 /* check the callback */
+    {
+        handle->receive_callback(type);                        /* run callback */
+    }
+    else
+    {
+        return;                                                /* return */
+    }
+}
+
+/**
+ * @brief     check the register cache range
+ * @param[in] reg iic register address
+ * @param[in] len data length
+ * @return    check result
+ *            - 0 not cached
+ *            - 1 cached
+ * @note      none
+ */
+static uint8_t a_amg8833_cache_check(uint8_t reg, uint16_t len)
+{
+    uint16_t i;
+    
+    if ((len == 0) || ((uint16_t)(reg + len) > AMG8833_CACHE_SIZE))           /* check range */
+    {
+        return 0;                                                             /* not cached */
+    }
+    for (i = reg; i < (uint16_t)(reg + len); i++)                             /* check all */
+    {
+        if (((AMG8833_CACHE_MASK >> i) & 0x01) == 0)                          /* check the mask */
+        {
+            return 0;                                                         /* not cached */
+        }
+    }
+    
+    return 1;                                                                 /* cached */
+}
+
+/**
+ * @brief     fill the register cache
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      pctl to intc and ave to ihysh are read in two transactions
+ */
+static uint8_t a_amg8833_cache_fill(amg8833_handle_t *handle)
+{
+    handle->cache_valid = 0;                                                                         /* flag invalid */
+    if (a_amg8833_bus_read(handle, AMG8833_REG_PCTL, &handle->cache[AMG8833_REG_PCTL],               /* read pctl to intc register */
+                           AMG8833_REG_INTC - AMG8833_REG_PCTL + 1) != 0)                              /* read pctl to intc register */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if (a_amg8833_bus_read(handle, AMG8833_REG_AVE, &handle->cache[AMG8833_REG_AVE],                 /* read ave to ihysh register */
+                           AMG8833_REG_IHYSH - AMG8833_REG_AVE + 1) != 0)                              /* read ave to ihysh register */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    handle->cache_valid = 1;                                                                         /* flag valid */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      read bytes
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       cached registers are served from the register cache when it is enabled
+ */
 static uint8_t a_amg8833_iic_read(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_read(handle->iic_addr, reg, data, len) != 0)        /* read the register */
+    uint16_t i;
+    
+    if ((handle->cache_enable != 0) && (a_amg8833_cache_check(reg, len) != 0))      /* check the cache */
+    {
+        if (handle->cache_valid == 0)                                               /* check valid */
+        {
+            if (a_amg8833_cache_fill(handle) != 0)                                  /* fill the cache */
+            {
+                return 1;                                                           /* return error */
+            }
+        }
+        for (i = 0; i < len; i++)                                                   /* copy all */
+        {
+            data[i] = handle->cache[reg + i];                                       /* copy the data */
+        }
+        
+        return 0;                                                                   /* success return 0 */
+    }
+    if (a_amg8833_bus_read(handle, reg, data, len) != 0)                            /* read the register */
     {
-        return 1;                                                       /* return error */
+        return 1;                                                                   /* return error */
     }
     else
     {
-        return 0;                                                       /* success return 0 */
+        return 0;                                                                   /* success return 0 */
     }
 }
 
@@ -109,18 +315,127 @@ static uint8_t a_amg8833_iic_read(amg8833_handle_t *handle, uint8_t reg, uint8_t
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the register cache is written through and invalidated by a reset
  */
 static uint8_t a_amg8833_iic_write(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_write(handle->iic_addr, reg, data, len) != 0)       /* write the register */
+    uint16_t i;
+    
+    if (a_amg8833_bus_write(handle, reg, data, len) != 0)                            /* write the register */
     {
-        return 1;                                                       /* return error */
+        handle->cache_valid = 0;                                                     /* flag invalid */
+        
+        return 1;                                                                    /* return error */
     }
-    else
+    if ((reg <= AMG8833_REG_RST) && ((uint16_t)(reg + len) > AMG8833_REG_RST))       /* check reset */
+    {
+        handle->cache_valid = 0;                                                     /* flag invalid */
+    }
+    else if (handle->cache_valid != 0)                                               /* check valid */
+    {
+        for (i = 0; (i < len) && ((uint16_t)(reg + i) < AMG8833_CACHE_SIZE); i++)    /* update all */
+        {
+            handle->cache[reg + i] = data[i];                                        /* write through */
+        }
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief orientation table definition, index = base + row * row_step + col * col_step
+ */
+const int8_t g_amg8833_orientation_table[8][3] =
+{
+    {63, -8, -1},        /**< identity */
+    {56,  1, -8},        /**< rotate 90 */
+    { 0,  8,  1},        /**< rotate 180 */
+    { 7, -1,  8},        /**< rotate 270 */
+    {56, -8,  1},        /**< mirror horizontal */
+    { 7,  8, -1},        /**< mirror vertical */
+    {63, -1, -8},        /**< transpose */
+    { 0,  1,  8},        /**< anti transpose */
+};
+
+/**
+ * @brief      decode the pixel buffer
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *buf pointer to a pixel register buffer
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @note       the pixels are written once in the handle orientation
+ */
+static void a_amg8833_decode_pixel(amg8833_handle_t *handle, const uint8_t *buf, int16_t raw[8][8])
+{
+    uint8_t i;
+    uint8_t j;
+    int16_t index;
+    int16_t row_step;
+    int16_t col_step;
+    int16_t *out;
+    
+    out = &raw[0][0];                                                                  /* get the output */
+    row_step = g_amg8833_orientation_table[handle->orientation][1];                    /* get the row step */
+    col_step = g_amg8833_orientation_table[handle->orientation][2];                    /* get the column step */
+    for (i = 0; i < 8; i++)                                                            /* run 8 times */
+    {
+        index = g_amg8833_orientation_table[handle->orientation][0] + i * row_step;    /* get the row start */
+        for (j = 0; j < 8; j++)                                                        /* run 8 times */
+        {
+            out[index] = AMG8833_PIXEL_DECODE(buf[i * 16 + j * 2 + 1],                 /* set the raw */
+                                              buf[i * 16 + j * 2 + 0]);                /* set the raw */
+            index += col_step;                                                         /* next column */
+        }
+    }
+}
+
+/**
+ * @brief     compare the pixel buffer with the last frame and save it
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] *buf pointer to a pixel register buffer
+ * @return    status code
+ *            - 0 frame not changed
+ *            - 1 frame changed
+ * @note      the whole buffer is compared with the last frame,
+ *            the sequence number increases on every new frame after the first one
+ */
+static uint8_t a_amg8833_frame_update(amg8833_handle_t *handle, const uint8_t *buf)
+{
+    if ((handle->frame_valid != 0) &&                                           /* check the last frame */
+        (memcmp(handle->frame, buf, AMG8833_FRAME_BUFFER_SIZE) == 0))           /* compare all bytes */
+    {
+        return 0;                                                               /* not changed */
+    }
+    if (handle->frame_valid != 0)                                               /* not the first frame */
+    {
+        handle->sequence++;                                                     /* next sequence */
+    }
+    memcpy(handle->frame, buf, AMG8833_FRAME_BUFFER_SIZE);                      /* save the frame */
+    handle->frame_valid = 1;                                                    /* flag valid */
+    
+    return 1;                                                                   /* changed */
+}
+
+/**
+ * @brief     check whether the pixel buffer is a new frame
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] *buf pointer to a pixel register buffer
+ * @return    status code
+ *            - 0 frame not changed
+ *            - 1 frame changed
+ * @note      every frame is a new frame when the change detection is disabled,
+ *            the frame is compared anyway so every read advances the snapshot sequence
+ */
+static uint8_t a_amg8833_frame_changed(amg8833_handle_t *handle, const uint8_t *buf)
+{
+    uint8_t res;
+    
+    res = a_amg8833_frame_update(handle, buf);                                  /* compare the frame */
+    if (handle->change_detect == 0)                                             /* check the change detection */
     {
-        return 0;                                                       /* success return 0 */
+        return 1;                                                               /* always changed */
     }
+    
+    return res;                                                                 /* return the result */
 }
 
 /**
@@ -132,37 +447,169 @@ static uint8_t a_amg8833_iic_write(amg8833_handle_t *handle, uint8_t reg, uint8_
  *            - 2 handle is NULL
  * @note      none
  */
-uint8_t amg8833_set_addr_pin(amg8833_handle_t *handle, amg8833_address_t addr_pin)
+uint8_t amg8833_set_addr_pin(amg8833_handle_t *handle, amg8833_address_t addr_pin)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    handle->iic_addr = (uint8_t)addr_pin;        /* set pin */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the iic address pin
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *addr_pin pointer to an address pin buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_addr_pin(amg8833_handle_t *handle, amg8833_address_t *addr_pin)
+{
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    *addr_pin = (amg8833_address_t)(handle->iic_addr);        /* get pin */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the pixel orientation
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] orientation pixel orientation
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 orientation is invalid
+ * @note      the orientation is applied to all the temperature array outputs
+ */
+uint8_t amg8833_set_orientation(amg8833_handle_t *handle, amg8833_orientation_t orientation)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (orientation > AMG8833_ORIENTATION_ANTI_TRANSPOSE)           /* check orientation */
+    {
+        return 4;                                                   /* return error */
+    }
+    
+    handle->orientation = (uint8_t)orientation;                     /* set orientation */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the pixel orientation
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *orientation pointer to a pixel orientation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_orientation(amg8833_handle_t *handle, amg8833_orientation_t *orientation)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    *orientation = (amg8833_orientation_t)(handle->orientation);          /* get orientation */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      this function can be called before amg8833_init
+ */
+uint8_t amg8833_set_register_cache(amg8833_handle_t *handle, amg8833_bool_t enable)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    
+    handle->cache_enable = (uint8_t)enable;               /* set enable */
+    handle->cache_valid = 0;                              /* flag invalid */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_register_cache(amg8833_handle_t *handle, amg8833_bool_t *enable)
+{
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    
+    *enable = (amg8833_bool_t)(handle->cache_enable);               /* get enable */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the frame change detection
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t amg8833_set_frame_change_detect(amg8833_handle_t *handle, amg8833_bool_t enable)
 {
-    if (handle == NULL)                          /* check handle */
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                                /* return error */
+        return 2;                                               /* return error */
     }
     
-    handle->iic_addr = (uint8_t)addr_pin;        /* set pin */
+    handle->change_detect = (uint8_t)enable;                    /* set enable */
     
-    return 0;                                    /* success return 0 */
+    return 0;                                                   /* success return 0 */
 }
 
 /**
- * @brief      get the iic address pin
+ * @brief      get the frame change detection status
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] *addr_pin pointer to an address pin buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  * @note       none
  */
-uint8_t amg8833_get_addr_pin(amg8833_handle_t *handle, amg8833_address_t *addr_pin)
+uint8_t amg8833_get_frame_change_detect(amg8833_handle_t *handle, amg8833_bool_t *enable)
 {
-    if (handle == NULL)                                       /* check handle */
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                                             /* return error */
+        return 2;                                               /* return error */
     }
     
-    *addr_pin = (amg8833_address_t)(handle->iic_addr);        /* get pin */
+    *enable = (amg8833_bool_t)(handle->change_detect);          /* get enable */
     
-    return 0;                                                 /* success return 0 */
+    return 0;                                                   /* success return 0 */
 }
 
 /**
@@ -188,25 +635,25 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
     {
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_init == NULL)                                                   /* check iic_init */
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))               /* check iic_init */
     {
         handle->debug_print("amg8833: iic_init is null.\n");                        /* iic_init is null */
        
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_deinit == NULL)                                                 /* check iic_deinit */
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))           /* check iic_deinit */
     {
         handle->debug_print("amg8833: iic_deinit is null.\n");                      /* iic_deinit is null */
        
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_read == NULL)                                                   /* check iic_read */
+    if ((handle->iic_read == NULL) && (handle->iic_read_ctx == NULL))               /* check iic_read */
     {
         handle->debug_print("amg8833: iic_read is null.\n");                        /* iic_read is null */
        
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_write == NULL)                                                  /* check iic_write */
+    if ((handle->iic_write == NULL) && (handle->iic_write_ctx == NULL))             /* check iic_write */
     {
         handle->debug_print("amg8833: iic_write is null.\n");                       /* iic_write is null */
        
@@ -218,24 +665,26 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
        
         return 3;                                                                   /* return error */
     }
-    if (handle->receive_callback == NULL)                                           /* check receive_callback */
+    if ((handle->receive_callback == NULL) &&                                       /* check receive_callback */
+        (handle->receive_callback_ctx == NULL))                                     /* check receive_callback_ctx */
     {
         handle->debug_print("amg8833: receive_callback is null.\n");                /* receive_callback is null */
        
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_init() != 0)                                                    /* iic init */
+    if (a_amg8833_bus_init(handle) != 0)                                            /* iic init */
     {
         handle->debug_print("amg8833: iic init failed.\n");                         /* iic init failed */
        
         return 3;                                                                   /* return error */
     }
+    handle->cache_valid = 0;                                                        /* flag cache invalid */
     prev = 0x00;                                                                    /* normal mode */
     res = a_amg8833_iic_write(handle, AMG8833_REG_PCTL, (uint8_t *)&prev, 1);       /* write pctl register */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("amg8833: write pctl register failed.\n");              /* write pctl register failed */
-        (void)handle->iic_deinit();                                                 /* iic deinit */
+        (void)a_amg8833_bus_deinit(handle);                                         /* iic deinit */
        
         return 1;                                                                   /* return error */
     }
@@ -245,7 +694,7 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("amg8833: write rst register failed.\n");               /* write rst register failed */
-        (void)handle->iic_deinit();                                                 /* iic deinit */
+        (void)a_amg8833_bus_deinit(handle);                                         /* iic deinit */
         
         return 4;                                                                   /* return error */
     }
@@ -255,10 +704,23 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("amg8833: write rst register failed.\n");               /* write rst register failed */
-        (void)handle->iic_deinit();                                                 /* iic deinit */
+        (void)a_amg8833_bus_deinit(handle);                                         /* iic deinit */
         
         return 4;                                                                   /* return error */
     }
+    if (handle->cache_enable != 0)                                                  /* check the cache */
+    {
+        res = a_amg8833_cache_fill(handle);                                         /* fill the cache */
+        if (res != 0)                                                               /* check result */
+        {
+            handle->debug_print("amg8833: fill register cache failed.\n");          /* fill register cache failed */
+            (void)a_amg8833_bus_deinit(handle);                                     /* iic deinit */
+            
+            return 1;                                                               /* return error */
+        }
+    }
+    handle->sequence = 0;                                                           /* reset the sequence */
+    handle->frame_valid = 0;                                                        /* flag last frame invalid */
     handle->inited = 1;                                                             /* flag finish initialization */
     
     return 0;                                                                       /* success return 0 */
@@ -296,7 +758,7 @@ uint8_t amg8833_deinit(amg8833_handle_t *handle)
        
         return 4;                                                                   /* return error */
     }
-    res = handle->iic_deinit();                                                     /* iic deinit */
+    res = a_amg8833_bus_deinit(handle);                                             /* iic deinit */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("amg8833: iic deinit failed.\n");                       /* iic deinit failed */
@@ -311,6 +773,42 @@ uint8_t amg8833_deinit(amg8833_handle_t *handle)
     }
 }
 
+/**
+ * @brief     clear the status flags and run the callbacks
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] status stat register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write sclr failed
+ * @note      none
+ */
+static uint8_t a_amg8833_status_handler(amg8833_handle_t *handle, uint8_t status)
+{
+    uint8_t res;
+    
+    res = a_amg8833_iic_write(handle, AMG8833_REG_SCLR, (uint8_t *)&status, 1);    /* write sclr register */
+    if (res != 0)                                                                  /* check result */
+    {
+        handle->debug_print("amg8833: write sclr register failed.\n");             /* write sclr register failed */
+        
+        return 1;                                                                  /* return error */
+    }
+    if ((status & (1 << AMG8833_STATUS_INTF)) != 0)                                /* if interrupt outbreak */
+    {
+        a_amg8833_receive_callback(handle, AMG8833_STATUS_INTF);                   /* run callback */
+    }
+    if ((status & (1 << AMG8833_STATUS_OVF_IRS)) != 0)                             /* if temperature output overflow */
+    {
+        a_amg8833_receive_callback(handle, AMG8833_STATUS_OVF_IRS);                /* run callback */
+    }
+    if ((status & (1 << AMG8833_STATUS_OVF_THS)) != 0)                             /* if thermistor temperature output overflow */
+    {
+        a_amg8833_receive_callback(handle, AMG8833_STATUS_OVF_THS);                /* run callback */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
 /**
  * @brief     irq handler
  * @param[in] *handle pointer to an amg8833 handle structure
@@ -341,36 +839,8 @@ uint8_t amg8833_irq_handler(amg8833_handle_t *handle)
         
         return 1;                                                                  /* return error */
     }
-    res = a_amg8833_iic_write(handle, AMG8833_REG_SCLR, (uint8_t *)&prev, 1);      /* write sclr register */
-    if (res != 0)                                                                  /* check result */
-    {
-        handle->debug_print("amg8833: write sclr register failed.\n");             /* write sclr register failed */
-        
-        return 1;                                                                  /* return error */
-    }
-    if ((prev & (1 << AMG8833_STATUS_INTF)) != 0)                                  /* if interrupt outbreak */
-    {
-        if (handle->receive_callback != NULL)                                      /* if receive callback */
-        {
-            handle->receive_callback(AMG8833_STATUS_INTF);                         /* run callback */
-        }
-    }
-    if ((prev & (1 << AMG8833_STATUS_OVF_IRS)) != 0)                               /* if temperature output overflow */
-    {
-        if (handle->receive_callback != NULL)                                      /* if receive callback */
-        {
-            handle->receive_callback(AMG8833_STATUS_OVF_IRS);                      /* run callback */
-        }
-    }
-    if ((prev & (1 << AMG8833_STATUS_OVF_THS)) != 0)                               /* if thermistor temperature output overflow */
-    {
-        if (handle->receive_callback != NULL)                                      /* if receive callback */
-        {
-            handle->receive_callback(AMG8833_STATUS_OVF_THS);                      /* run callback */
-        }
-    }
     
-    return 0;                                                                      /* success return 0 */
+    return a_amg8833_status_handler(handle, prev);                                 /* handle the status */
 }
 
 /**
@@ -897,7 +1367,201 @@ uint8_t amg8833_get_average_mode(amg8833_handle_t *handle, amg8833_average_mode_
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t amg8833_set_interrupt_high_level(amg8833_handle_t *handle, int16_t level)
+uint8_t amg8833_set_interrupt_high_level(amg8833_handle_t *handle, int16_t level)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    buf[0] = (level >> 0) & 0xFF;                                                      /* get lower */
+    buf[1] = (level >> 8) & 0xF;                                                       /* get upper */
+    res = a_amg8833_iic_write(handle, AMG8833_REG_INTHL, (uint8_t *)&buf[0], 1);       /* write inthl register */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("amg8833: write inthl register failed.\n");                /* write inthl register failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    res = a_amg8833_iic_write(handle, AMG8833_REG_INTHH, (uint8_t *)&buf[1], 1);       /* write inthh register */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("amg8833: write inthh register failed.\n");                /* write inthh register failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the interrupt high level
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *level pointer to an interrupt high level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt high level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t amg8833_get_interrupt_high_level(amg8833_handle_t *handle, int16_t *level)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INTHL, (uint8_t *)&buf[0], 1);       /* read inthl register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read inthl register failed.\n");                /* read inthl register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INTHH, (uint8_t *)&buf[1], 1);       /* read inthh register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read inthh register failed.\n");                /* read inthh register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    if ((buf[1] & (1 << 3)) != 0)                                                     /* check negative */
+    {
+        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | 
+                 ((uint16_t)(0xF) << 12) | (buf[0] << 0));                            /* get the level */
+    }
+    else
+    {
+        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | (buf[0] << 0));                /* get the level */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the interrupt low level
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] level interrupt low level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt low level failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t amg8833_set_interrupt_low_level(amg8833_handle_t *handle, int16_t level)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    buf[0] = (level >> 0) & 0xFF;                                                      /* get lower */
+    buf[1] = (level >> 8) & 0xF;                                                       /* get upper */
+    res = a_amg8833_iic_write(handle, AMG8833_REG_INTLL, (uint8_t *)&buf[0], 1);       /* write intll register */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("amg8833: write intll register failed.\n");                /* write intll register failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    res = a_amg8833_iic_write(handle, AMG8833_REG_INTLH, (uint8_t *)&buf[1], 1);       /* write intlh register */
+    if (res != 0)                                                                      /* check result */
+    {
+        handle->debug_print("amg8833: write intlh register failed.\n");                /* write intlh register failed */
+       
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the interrupt low level
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *level pointer to an interrupt low level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt low level failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t amg8833_get_interrupt_low_level(amg8833_handle_t *handle, int16_t *level)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INTLL, (uint8_t *)&buf[0], 1);       /* read intll register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read intll register failed.\n");                /* read intll register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INTLH, (uint8_t *)&buf[1], 1);       /* read intlh register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read intlh register failed.\n");                /* read intlh register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    if ((buf[1] & (1 << 3)) != 0)                                                     /* check negative */
+    {
+        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | 
+                 ((uint16_t)(0xF) << 12) | (buf[0] << 0));                            /* get the level */
+    }
+    else
+    {
+        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | (buf[0] << 0));                /* get the level */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the interrupt hysteresis level
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] level interrupt hysteresis level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt hysteresis level failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t amg8833_set_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t level)
 {
     uint8_t res;
     uint8_t buf[2];
@@ -913,17 +1577,17 @@ uint8_t amg8833_set_interrupt_high_level(amg8833_handle_t *handle, int16_t level
     
     buf[0] = (level >> 0) & 0xFF;                                                      /* get lower */
     buf[1] = (level >> 8) & 0xF;                                                       /* get upper */
-    res = a_amg8833_iic_write(handle, AMG8833_REG_INTHL, (uint8_t *)&buf[0], 1);       /* write inthl register */
+    res = a_amg8833_iic_write(handle, AMG8833_REG_IHYSL, (uint8_t *)&buf[0], 1);       /* write ihysl register */
     if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("amg8833: write inthl register failed.\n");                /* write inthl register failed */
+        handle->debug_print("amg8833: write ihysl register failed.\n");                /* write ihysl register failed */
        
         return 1;                                                                      /* return error */
     }
-    res = a_amg8833_iic_write(handle, AMG8833_REG_INTHH, (uint8_t *)&buf[1], 1);       /* write inthh register */
+    res = a_amg8833_iic_write(handle, AMG8833_REG_IHYSH, (uint8_t *)&buf[1], 1);       /* write ihysh register */
     if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("amg8833: write inthh register failed.\n");                /* write inthh register failed */
+        handle->debug_print("amg8833: write ihysh register failed.\n");                /* write ihysh register failed */
        
         return 1;                                                                      /* return error */
     }
@@ -932,17 +1596,17 @@ uint8_t amg8833_set_interrupt_high_level(amg8833_handle_t *handle, int16_t level
 }
 
 /**
- * @brief      get the interrupt high level
+ * @brief      get the interrupt hysteresis level
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] *level pointer to an interrupt high level buffer
+ * @param[out] *level pointer to an interrupt hysteresis level buffer
  * @return     status code
  *             - 0 success
- *             - 1 get interrupt high level failed
+ *             - 1 get interrupt hysteresis level failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t amg8833_get_interrupt_high_level(amg8833_handle_t *handle, int16_t *level)
+uint8_t amg8833_get_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t *level)
 {
     uint8_t res;
     uint8_t buf[2];
@@ -956,17 +1620,17 @@ uint8_t amg8833_get_interrupt_high_level(amg8833_handle_t *handle, int16_t *leve
         return 3;                                                                     /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INTHL, (uint8_t *)&buf[0], 1);       /* read inthl register */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_IHYSL, (uint8_t *)&buf[0], 1);       /* read ihysl register */
     if (res != 0)                                                                     /* check result */
     {
-        handle->debug_print("amg8833: read inthl register failed.\n");                /* read inthl register failed */
+        handle->debug_print("amg8833: read ihysl register failed.\n");                /* read ihysl register failed */
        
         return 1;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INTHH, (uint8_t *)&buf[1], 1);       /* read inthh register */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_IHYSH, (uint8_t *)&buf[1], 1);       /* read ihysh register */
     if (res != 0)                                                                     /* check result */
     {
-        handle->debug_print("amg8833: read inthh register failed.\n");                /* read inthh register failed */
+        handle->debug_print("amg8833: read ihysh register failed.\n");                /* read ihysh register failed */
        
         return 1;                                                                     /* return error */
     }
@@ -984,20 +1648,22 @@ uint8_t amg8833_get_interrupt_high_level(amg8833_handle_t *handle, int16_t *leve
 }
 
 /**
- * @brief     set the interrupt low level
+ * @brief     set the interrupt high, low and hysteresis levels
  * @param[in] *handle pointer to an amg8833 handle structure
- * @param[in] level interrupt low level
+ * @param[in] high interrupt high level
+ * @param[in] low interrupt low level
+ * @param[in] hysteresis interrupt hysteresis level
  * @return    status code
  *            - 0 success
- *            - 1 set interrupt low level failed
+ *            - 1 set interrupt levels failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      inthl to ihysh are written in one transaction
  */
-uint8_t amg8833_set_interrupt_low_level(amg8833_handle_t *handle, int16_t level)
+uint8_t amg8833_set_interrupt_levels(amg8833_handle_t *handle, int16_t high, int16_t low, int16_t hysteresis)
 {
     uint8_t res;
-    uint8_t buf[2];
+    uint8_t buf[6];
     
     if (handle == NULL)                                                                /* check handle */
     {
@@ -1008,20 +1674,17 @@ uint8_t amg8833_set_interrupt_low_level(amg8833_handle_t *handle, int16_t level)
         return 3;                                                                      /* return error */
     }
     
-    buf[0] = (level >> 0) & 0xFF;                                                      /* get lower */
-    buf[1] = (level >> 8) & 0xF;                                                       /* get upper */
-    res = a_amg8833_iic_write(handle, AMG8833_REG_INTLL, (uint8_t *)&buf[0], 1);       /* write intll register */
-    if (res != 0)                                                                      /* check result */
-    {
-        handle->debug_print("amg8833: write intll register failed.\n");                /* write intll register failed */
-       
-        return 1;                                                                      /* return error */
-    }
-    res = a_amg8833_iic_write(handle, AMG8833_REG_INTLH, (uint8_t *)&buf[1], 1);       /* write intlh register */
+    buf[0] = (high >> 0) & 0xFF;                                                       /* get high lower */
+    buf[1] = (high >> 8) & 0xF;                                                        /* get high upper */
+    buf[2] = (low >> 0) & 0xFF;                                                        /* get low lower */
+    buf[3] = (low >> 8) & 0xF;                                                         /* get low upper */
+    buf[4] = (hysteresis >> 0) & 0xFF;                                                 /* get hysteresis lower */
+    buf[5] = (hysteresis >> 8) & 0xF;                                                  /* get hysteresis upper */
+    res = a_amg8833_iic_write(handle, AMG8833_REG_INTHL, (uint8_t *)buf, 6);           /* write inthl to ihysh register */
     if (res != 0)                                                                      /* check result */
     {
-        handle->debug_print("amg8833: write intlh register failed.\n");                /* write intlh register failed */
-       
+        handle->debug_print("amg8833: write inthl to ihysh register failed.\n");       /* write inthl to ihysh register failed */
+    
         return 1;                                                                      /* return error */
     }
     
@@ -1029,20 +1692,24 @@ uint8_t amg8833_set_interrupt_low_level(amg8833_handle_t *handle, int16_t level)
 }
 
 /**
- * @brief      get the interrupt low level
+ * @brief      get the interrupt high, low and hysteresis levels
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] *level pointer to an interrupt low level buffer
+ * @param[out] *high pointer to an interrupt high level buffer
+ * @param[out] *low pointer to an interrupt low level buffer
+ * @param[out] *hysteresis pointer to an interrupt hysteresis level buffer
  * @return     status code
  *             - 0 success
- *             - 1 get interrupt low level failed
+ *             - 1 get interrupt levels failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       inthl to ihysh are read in one transaction
  */
-uint8_t amg8833_get_interrupt_low_level(amg8833_handle_t *handle, int16_t *level)
+uint8_t amg8833_get_interrupt_levels(amg8833_handle_t *handle, int16_t *high, int16_t *low, int16_t *hysteresis)
 {
     uint8_t res;
-    uint8_t buf[2];
+    uint8_t i;
+    uint8_t buf[6];
+    int16_t level[3];
     
     if (handle == NULL)                                                               /* check handle */
     {
@@ -1053,288 +1720,614 @@ uint8_t amg8833_get_interrupt_low_level(amg8833_handle_t *handle, int16_t *level
         return 3;                                                                     /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INTLL, (uint8_t *)&buf[0], 1);       /* read intll register */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INTHL, (uint8_t *)buf, 6);           /* read inthl to ihysh register */
     if (res != 0)                                                                     /* check result */
     {
-        handle->debug_print("amg8833: read intll register failed.\n");                /* read intll register failed */
-       
+        handle->debug_print("amg8833: read inthl to ihysh register failed.\n");       /* read inthl to ihysh register failed */
+    
         return 1;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INTLH, (uint8_t *)&buf[1], 1);       /* read intlh register */
-    if (res != 0)                                                                     /* check result */
+    for (i = 0; i < 3; i++)                                                           /* run 3 times */
     {
-        handle->debug_print("amg8833: read intlh register failed.\n");                /* read intlh register failed */
-       
-        return 1;                                                                     /* return error */
+        if ((buf[i * 2 + 1] & (1 << 3)) != 0)                                         /* check negative */
+        {
+            level[i] = (int16_t)(((uint16_t)(buf[i * 2 + 1]) << 8) | 
+                       ((uint16_t)(0xF) << 12) | (buf[i * 2 + 0] << 0));              /* get the level */
+        }
+        else
+        {
+            level[i] = (int16_t)(((uint16_t)(buf[i * 2 + 1]) << 8) | 
+                       (buf[i * 2 + 0] << 0));                                        /* get the level */
+        }
     }
-    if ((buf[1] & (1 << 3)) != 0)                                                     /* check negative */
+    *high = level[0];                                                                 /* set the high level */
+    *low = level[1];                                                                  /* set the low level */
+    *hysteresis = level[2];                                                           /* set the hysteresis level */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert the interrupt level to the register raw data
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  temp temperature
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t amg8833_interrupt_level_convert_to_register(amg8833_handle_t *handle, float temp, int16_t *reg)
+{
+    if (handle == NULL)                    /* check handle */
     {
-        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | 
-                 ((uint16_t)(0xF) << 12) | (buf[0] << 0));                            /* get the level */
+        return 2;                          /* return error */
     }
-    else
+    if (handle->inited != 1)               /* check handle initialization */
     {
-        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | (buf[0] << 0));                /* get the level */
+        return 3;                          /* return error */
     }
     
-    return 0;                                                                         /* success return 0 */
+    *reg = (int16_t)(temp / 0.25f);        /* convert real data to register data */
+    
+    return 0;                              /* success return 0 */
 }
 
 /**
- * @brief     set the interrupt hysteresis level
- * @param[in] *handle pointer to an amg8833 handle structure
- * @param[in] level interrupt hysteresis level
- * @return    status code
- *            - 0 success
- *            - 1 set interrupt hysteresis level failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      convert the register raw data to the interrupt level
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *temp pointer to a temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t amg8833_set_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t level)
+uint8_t amg8833_interrupt_level_convert_to_data(amg8833_handle_t *handle, int16_t reg, float *temp)
+{
+    if (handle == NULL)                  /* check handle */
+    {
+        return 2;                        /* return error */
+    }
+    if (handle->inited != 1)             /* check handle initialization */
+    {
+        return 3;                        /* return error */
+    }
+    
+    *temp = (float)(reg) * 0.25f;        /* convert raw data to real data */
+    
+    return 0;                            /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *temp pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *temp)
 {
     uint8_t res;
     uint8_t buf[2];
+    int16_t data;
     
-    if (handle == NULL)                                                                /* check handle */
+    if (handle == NULL)                                                              /* check handle */
     {
-        return 2;                                                                      /* return error */
+        return 2;                                                                    /* return error */
     }
-    if (handle->inited != 1)                                                           /* check handle initialization */
+    if (handle->inited != 1)                                                         /* check handle initialization */
     {
-        return 3;                                                                      /* return error */
+        return 3;                                                                    /* return error */
     }
     
-    buf[0] = (level >> 0) & 0xFF;                                                      /* get lower */
-    buf[1] = (level >> 8) & 0xF;                                                       /* get upper */
-    res = a_amg8833_iic_write(handle, AMG8833_REG_IHYSL, (uint8_t *)&buf[0], 1);       /* write ihysl register */
-    if (res != 0)                                                                      /* check result */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)&buf[0], 1);       /* read tthl register */
+    if (res != 0)                                                                    /* check result */
     {
-        handle->debug_print("amg8833: write ihysl register failed.\n");                /* write ihysl register failed */
+        handle->debug_print("amg8833: read tthl register failed.\n");                /* read tthl register failed */
        
-        return 1;                                                                      /* return error */
+        return 1;                                                                    /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHH, (uint8_t *)&buf[1], 1);       /* read tthh register */
+    if (res != 0)                                                                    /* check result */
+    {
+        handle->debug_print("amg8833: read tthh register failed.\n");                /* read tthh register failed */
+       
+        return 1;                                                                    /* return error */
+    }
+    *raw = (int16_t)(((uint16_t)(buf[1] & 0xF) << 8) | (buf[0] << 0));               /* get the raw */
+    data = AMG8833_THERMISTOR_DECODE(buf[1], buf[0]);                                /* decode the thermistor */
+    *temp = data * 0.0625f;                                                          /* convert the temperature */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @param[out] **temp pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frame not changed
+ * @note       pixel_64 pixel_63 ... pixel_57
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ * @note       pixel_08 pixel_07 ... pixel_01
+ * @note       the figure shows the identity orientation, see amg8833_set_orientation
+ */
+uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][8], float temp[8][8])
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    uint8_t buf[128];
+    
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);                /* read t01l register */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("amg8833: read t01l register failed.\n");                       /* read t01l register failed */
+       
+        return 1;                                                                           /* return error */
+    }
+    if (a_amg8833_frame_changed(handle, buf) == 0)                                          /* check the frame */
+    {
+        return 5;                                                                           /* return not changed */
+    }
+    a_amg8833_decode_pixel(handle, buf, raw);                                               /* decode the pixel */
+    for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+    {
+        for (j = 0; j < 8; j++)                                                             /* run 8 times */
+        {
+            temp[i][j] = (float)raw[i][j] * 0.25f;                                          /* get converted temperature */
+        }
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      read the raw temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frame not changed
+ * @note       raw data is the sign extended 12 bits pixel output, 0.25C per lsb
+ * @note       the pixel order is the same as amg8833_read_temperature_array
+ */
+uint8_t amg8833_read_temperature_array_raw(amg8833_handle_t *handle, int16_t raw[8][8])
+{
+    uint8_t res;
+    uint8_t buf[128];
+    
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);                /* read t01l register */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("amg8833: read t01l register failed.\n");                       /* read t01l register failed */
+    
+        return 1;                                                                           /* return error */
     }
-    res = a_amg8833_iic_write(handle, AMG8833_REG_IHYSH, (uint8_t *)&buf[1], 1);       /* write ihysh register */
-    if (res != 0)                                                                      /* check result */
+    if (a_amg8833_frame_changed(handle, buf) == 0)                                          /* check the frame */
     {
-        handle->debug_print("amg8833: write ihysh register failed.\n");                /* write ihysh register failed */
-       
-        return 1;                                                                      /* return error */
+        return 5;                                                                           /* return not changed */
     }
+    a_amg8833_decode_pixel(handle, buf, raw);                                               /* decode the pixel */
     
-    return 0;                                                                          /* success return 0 */
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief      get the interrupt hysteresis level
+ * @brief      read the fixed point temperature array
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] *level pointer to an interrupt hysteresis level buffer
+ * @param[in]  format fixed point format
+ * @param[out] **temp pointer to a fixed point temperature buffer
  * @return     status code
  *             - 0 success
- *             - 1 get interrupt hysteresis level failed
+ *             - 1 read temperature array failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 format is invalid
+ *             - 5 frame not changed
+ * @note       no float operation is used
+ * @note       the pixel order is the same as amg8833_read_temperature_array
  */
-uint8_t amg8833_get_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t *level)
+uint8_t amg8833_read_temperature_array_fixed(amg8833_handle_t *handle, amg8833_fixed_point_t format, int32_t temp[8][8])
 {
     uint8_t res;
-    uint8_t buf[2];
+    uint8_t i;
+    uint8_t j;
+    int32_t scale;
+    uint8_t buf[128];
+    int16_t raw[8][8];
     
-    if (handle == NULL)                                                               /* check handle */
+    if (handle == NULL)                                                                     /* check handle */
     {
-        return 2;                                                                     /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                          /* check handle initialization */
+    if (handle->inited != 1)                                                                /* check handle initialization */
     {
-        return 3;                                                                     /* return error */
+        return 3;                                                                           /* return error */
     }
-    
-    res = a_amg8833_iic_read(handle, AMG8833_REG_IHYSL, (uint8_t *)&buf[0], 1);       /* read ihysl register */
-    if (res != 0)                                                                     /* check result */
+    if (format == AMG8833_FIXED_POINT_Q2)                                                   /* 0.25C */
     {
-        handle->debug_print("amg8833: read ihysl register failed.\n");                /* read ihysl register failed */
-       
-        return 1;                                                                     /* return error */
+        scale = 1;                                                                          /* x1 */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_IHYSH, (uint8_t *)&buf[1], 1);       /* read ihysh register */
-    if (res != 0)                                                                     /* check result */
+    else if (format == AMG8833_FIXED_POINT_Q8)                                              /* 1/256C */
     {
-        handle->debug_print("amg8833: read ihysh register failed.\n");                /* read ihysh register failed */
-       
-        return 1;                                                                     /* return error */
+        scale = 64;                                                                         /* x64 */
     }
-    if ((buf[1] & (1 << 3)) != 0)                                                     /* check negative */
+    else if (format == AMG8833_FIXED_POINT_CENTI)                                           /* 0.01C */
     {
-        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | 
-                 ((uint16_t)(0xF) << 12) | (buf[0] << 0));                            /* get the level */
+        scale = 25;                                                                         /* x25 */
     }
     else
     {
-        *level = (int16_t)(((uint16_t)(buf[1]) << 8) | (buf[0] << 0));                /* get the level */
+        handle->debug_print("amg8833: format is invalid.\n");                               /* format is invalid */
+    
+        return 4;                                                                           /* return error */
     }
     
-    return 0;                                                                         /* success return 0 */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);                /* read t01l register */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("amg8833: read t01l register failed.\n");                       /* read t01l register failed */
+    
+        return 1;                                                                           /* return error */
+    }
+    if (a_amg8833_frame_changed(handle, buf) == 0)                                          /* check the frame */
+    {
+        return 5;                                                                           /* return not changed */
+    }
+    a_amg8833_decode_pixel(handle, buf, raw);                                               /* decode the pixel */
+    for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+    {
+        for (j = 0; j < 8; j++)                                                             /* run 8 times */
+        {
+            temp[i][j] = (int32_t)raw[i][j] * scale;                                        /* get converted temperature */
+        }
+    }
+    
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief      convert the interrupt level to the register raw data
+ * @brief      read the temperature array into a frame buffer
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[in]  temp temperature
- * @param[out] *reg pointer to a register raw buffer
+ * @param[out] *buf pointer to a frame buffer
  * @return     status code
  *             - 0 success
+ *             - 1 read temperature array failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 5 frame not changed
+ * @note       buf must be at least AMG8833_FRAME_BUFFER_SIZE bytes and is passed to the iic_read function directly
+ * @note       use AMG8833_FRAME_PIXEL or AMG8833_FRAME_PIXEL_AT to get the pixels
  */
-uint8_t amg8833_interrupt_level_convert_to_register(amg8833_handle_t *handle, float temp, int16_t *reg)
+uint8_t amg8833_read_temperature_array_buffer(amg8833_handle_t *handle, uint8_t *buf)
 {
-    if (handle == NULL)                    /* check handle */
+    uint8_t res;
+    
+    if (handle == NULL)                                                                      /* check handle */
     {
-        return 2;                          /* return error */
+        return 2;                                                                            /* return error */
     }
-    if (handle->inited != 1)               /* check handle initialization */
+    if (handle->inited != 1)                                                                 /* check handle initialization */
     {
-        return 3;                          /* return error */
+        return 3;                                                                            /* return error */
     }
     
-    *reg = (int16_t)(temp / 0.25f);        /* convert real data to register data */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, buf, AMG8833_FRAME_BUFFER_SIZE);      /* read t01l register */
+    if (res != 0)                                                                            /* check result */
+    {
+        handle->debug_print("amg8833: read t01l register failed.\n");                        /* read t01l register failed */
     
-    return 0;                              /* success return 0 */
+        return 1;                                                                            /* return error */
+    }
+    if (a_amg8833_frame_changed(handle, buf) == 0)                                           /* check the frame */
+    {
+        return 5;                                                                            /* return not changed */
+    }
+    
+    return 0;                                                                                /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the interrupt level
+ * @brief      read the status, the thermistor and the temperature array
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[in]  reg register raw data
- * @param[out] *temp pointer to a temperature buffer
+ * @param[out] *snapshot pointer to a snapshot structure
  * @return     status code
  *             - 0 success
+ *             - 1 read snapshot failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       stat to tthh and t01l to t64h are read in two transactions,
+ *             the sequence number increases when any array read or snapshot of the handle gets a new frame
  */
-uint8_t amg8833_interrupt_level_convert_to_data(amg8833_handle_t *handle, int16_t reg, float *temp)
+uint8_t amg8833_read_snapshot(amg8833_handle_t *handle, amg8833_snapshot_t *snapshot)
 {
-    if (handle == NULL)                  /* check handle */
+    uint8_t res;
+    uint8_t reg[AMG8833_REG_TTHH - AMG8833_REG_STAT + 1];
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];
+    int16_t data;
+    
+    if (handle == NULL)                                                                      /* check handle */
     {
-        return 2;                        /* return error */
+        return 2;                                                                            /* return error */
     }
-    if (handle->inited != 1)             /* check handle initialization */
+    if (handle->inited != 1)                                                                 /* check handle initialization */
     {
-        return 3;                        /* return error */
+        return 3;                                                                            /* return error */
     }
     
-    *temp = (float)(reg) * 0.25f;        /* convert raw data to real data */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_STAT, reg, sizeof(reg));                    /* read stat to tthh register */
+    if (res != 0)                                                                            /* check result */
+    {
+        handle->debug_print("amg8833: read stat to tthh register failed.\n");                /* read stat to tthh register failed */
     
-    return 0;                            /* success return 0 */
+        return 1;                                                                            /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, buf, AMG8833_FRAME_BUFFER_SIZE);      /* read t01l register */
+    if (res != 0)                                                                            /* check result */
+    {
+        handle->debug_print("amg8833: read t01l register failed.\n");                        /* read t01l register failed */
+    
+        return 1;                                                                            /* return error */
+    }
+    snapshot->status = reg[0];                                                               /* set the status */
+    data = AMG8833_THERMISTOR_DECODE(reg[AMG8833_REG_TTHH - AMG8833_REG_STAT],               /* decode the thermistor */
+                                     reg[AMG8833_REG_TTHL - AMG8833_REG_STAT]);              /* decode the thermistor */
+    snapshot->thermistor = data;                                                             /* set the thermistor */
+    a_amg8833_decode_pixel(handle, buf, snapshot->raw);                                      /* decode the pixel */
+    (void)a_amg8833_frame_update(handle, buf);                                               /* count a new sensor frame */
+    snapshot->sequence = handle->sequence;                                                   /* set the sequence */
+    
+    return 0;                                                                                /* success return 0 */
 }
 
 /**
- * @brief      read the temperature
+ * @brief      init the frame acquisition
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] *raw pointer to a raw temperature buffer
- * @param[out] *temp pointer to a converted temperature buffer
+ * @param[out] *acquire pointer to an acquire structure
  * @return     status code
  *             - 0 success
- *             - 1 read temperature failed
+ *             - 1 acquire init failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *temp)
+uint8_t amg8833_acquire_init(amg8833_handle_t *handle, amg8833_acquire_t *acquire)
 {
     uint8_t res;
-    uint8_t buf[2];
-    int16_t data;
+    uint8_t prev;
     
-    if (handle == NULL)                                                              /* check handle */
+    if (handle == NULL)                                                                             /* check handle */
     {
-        return 2;                                                                    /* return error */
+        return 2;                                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                         /* check handle initialization */
+    if (handle->inited != 1)                                                                        /* check handle initialization */
     {
-        return 3;                                                                    /* return error */
+        return 3;                                                                                   /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)&buf[0], 1);       /* read tthl register */
-    if (res != 0)                                                                    /* check result */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_FPSC, (uint8_t *)&prev, 1);                        /* read fpsc register */
+    if (res != 0)                                                                                   /* check result */
     {
-        handle->debug_print("amg8833: read tthl register failed.\n");                /* read tthl register failed */
-       
-        return 1;                                                                    /* return error */
+        handle->debug_print("amg8833: read fpsc register failed.\n");                               /* read fpsc register failed */
+        
+        return 1;                                                                                   /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHH, (uint8_t *)&buf[1], 1);       /* read tthh register */
-    if (res != 0)                                                                    /* check result */
+    memset(acquire, 0, sizeof(amg8833_acquire_t));                                                  /* clear the acquire */
+    if (((prev >> 0) & 0x01) != 0)                                                                  /* 1 fps */
     {
-        handle->debug_print("amg8833: read tthh register failed.\n");                /* read tthh register failed */
-       
-        return 1;                                                                    /* return error */
+        acquire->nominal = 1000000;                                                                 /* 1000 ms */
     }
-    *raw = (int16_t)(((uint16_t)(buf[1] & 0xF) << 8) | (buf[0] << 0));               /* get the raw */
-    data = (int16_t)(((uint16_t)(buf[1] & 0x7) << 8) | (buf[0] << 0));               /* get the raw */
-    if ((buf[1] & 0x8) != 0)                                                         /* if negative */
+    else                                                                                            /* 10 fps */
     {
-        data = data * (-1);                                                          /* x (-1) */
+        acquire->nominal = 100000;                                                                  /* 100 ms */
     }
-    *temp = data * 0.0625f;                                                          /* convert the temperature */
+    acquire->period = acquire->nominal;                                                             /* start from the nominal period */
+    acquire->step = acquire->nominal / 32;                                                          /* search step */
     
-    return 0;                                                                        /* success return 0 */
+    return 0;                                                                                       /* success return 0 */
 }
 
 /**
- * @brief      read the temperature array
+ * @brief      read the next new frame with the phase locked acquisition
  * @param[in]  *handle pointer to an amg8833 handle structure
- * @param[out] **raw pointer to a raw temperature buffer
- * @param[out] **temp pointer to a converted temperature buffer
+ * @param[in]  *acquire pointer to an acquire structure
+ * @param[in]  timestamp current timestamp in us
+ * @param[out] *buf pointer to a frame buffer
+ * @param[out] *next pointer to a next read timestamp buffer
  * @return     status code
  *             - 0 success
- *             - 1 read temperature array failed
+ *             - 1 acquire read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       pixel_64 pixel_63 ... pixel_57
- *             .                            .
- *             .                            .
- *             .                            .
- *             .                            .
- *             .                            .
- * @note       pixel_08 pixel_07 ... pixel_01
+ *             - 4 frame is not ready
+ * @note       none
  */
-uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][8], float temp[8][8])
+uint8_t amg8833_acquire_read(amg8833_handle_t *handle, amg8833_acquire_t *acquire, uint32_t timestamp,
+                             uint8_t *buf, uint32_t *next)
 {
     uint8_t res;
-    uint8_t i;
-    uint8_t j;
-    uint8_t buf[128];
+    uint8_t prev;
+    uint32_t n;
+    uint32_t measured;
     
-    if (handle == NULL)                                                                     /* check handle */
+    if (handle == NULL)                                                                             /* check handle */
     {
-        return 2;                                                                           /* return error */
+        return 2;                                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if (handle->inited != 1)                                                                        /* check handle initialization */
     {
-        return 3;                                                                           /* return error */
+        return 3;                                                                                   /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);                /* read t01l register */
-    if (res != 0)                                                                           /* check result */
+    if ((acquire->valid != 0) && ((int32_t)(timestamp - acquire->next) < 0))                        /* before the next read */
     {
-        handle->debug_print("amg8833: read t01l register failed.\n");                       /* read t01l register failed */
-       
-        return 1;                                                                           /* return error */
+        *next = acquire->next;                                                                      /* set the next read */
+        
+        return 4;                                                                                   /* return not ready */
     }
-    for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, buf, AMG8833_FRAME_BUFFER_SIZE);             /* read t01l register */
+    if (res != 0)                                                                                   /* check result */
     {
-        for (j = 0; j < 8; j++)                                                             /* run 8 times */
+        handle->debug_print("amg8833: read t01l register failed.\n");                               /* read t01l register failed */
+        
+        return 1;                                                                                   /* return error */
+    }
+    if ((acquire->valid != 0) &&
+        (memcmp(buf, acquire->buf, AMG8833_FRAME_BUFFER_SIZE) == 0))                                /* the same frame */
+    {
+        acquire->duplicates++;                                                                      /* duplicates++ */
+        acquire->early = 1;                                                                         /* the read was before the boundary */
+        acquire->next = timestamp + acquire->step;                                                  /* retry after one step */
+        *next = acquire->next;                                                                      /* set the next read */
+        
+        return 4;                                                                                   /* return not ready */
+    }
+    
+    if (acquire->valid != 0)                                                                        /* not the first frame */
+    {
+        n = (timestamp - acquire->last + acquire->period / 2) / acquire->period;                    /* elapsed frame periods */
+        if (n == 0)                                                                                 /* a short frame */
+        {
+            n = 1;                                                                                  /* at least one frame */
+        }
+        if ((acquire->locked != 0) && (n > 1))                                                      /* frames were missed */
+        {
+            acquire->dropped += n - 1;                                                              /* dropped */
+        }
+        acquire->count += n;                                                                        /* frame periods since the anchor */
+        if (acquire->early != 0)                                                                    /* the boundary is between the last read and this one */
+        {
+            if ((acquire->locked != 0) && (acquire->count >= AMG8833_ACQUIRE_PROBE / 2))            /* measure the period */
+            {
+                measured = (timestamp - acquire->anchor) / acquire->count;                          /* average period */
+                if ((measured > acquire->nominal - acquire->nominal / 8) &&
+                    (measured < acquire->nominal + acquire->nominal / 8))                           /* check the range */
+                {
+                    acquire->period = (uint32_t)((int32_t)acquire->period +
+                                      ((int32_t)(measured - acquire->period)) / 2);                 /* track the period */
+                }
+            }
+            acquire->anchor = timestamp;                                                            /* set the anchor */
+            acquire->count = 0;                                                                     /* clear the count */
+            acquire->locked = 1;                                                                    /* phase locked */
+            acquire->early = 0;                                                                     /* clear the flag */
+        }
+        else if ((acquire->locked != 0) && (acquire->probe != 0))                                   /* the boundary came before the probe */
+        {
+            acquire->period -= acquire->step / AMG8833_ACQUIRE_PROBE;                               /* shorten the period */
+            acquire->anchor = timestamp;                                                            /* move the anchor */
+            acquire->count = 0;                                                                     /* clear the count */
+        }
+    }
+    memcpy(acquire->buf, buf, AMG8833_FRAME_BUFFER_SIZE);                                           /* save the frame */
+    acquire->valid = 1;                                                                             /* set valid */
+    acquire->last = timestamp;                                                                      /* set the last timestamp */
+    acquire->frames++;                                                                              /* frames++ */
+    if (acquire->locked == 0)                                                                       /* not locked */
+    {
+        acquire->next = timestamp + acquire->step;                                                  /* search the boundary */
+    }
+    else if ((acquire->count + 1) >= AMG8833_ACQUIRE_PROBE)                                         /* probe the boundary */
+    {
+        acquire->probe = 1;                                                                         /* set the probe */
+        acquire->next = acquire->anchor + (acquire->count + 1) * acquire->period - acquire->step;   /* read one step early */
+    }
+    else
+    {
+        acquire->probe = 0;                                                                         /* clear the probe */
+        acquire->next = acquire->anchor + (acquire->count + 1) * acquire->period + acquire->step / 2;/* read half a step late */
+    }
+    *next = acquire->next;                                                                          /* set the next read */
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_STAT, (uint8_t *)&prev, 1);                        /* read stat register */
+    if (res != 0)                                                                                   /* check result */
+    {
+        handle->debug_print("amg8833: read stat register failed.\n");                               /* read stat register failed */
+        
+        return 1;                                                                                   /* return error */
+    }
+    if ((prev & ((1 << AMG8833_STATUS_INTF) | (1 << AMG8833_STATUS_OVF_IRS) |
+                 (1 << AMG8833_STATUS_OVF_THS))) != 0)                                              /* check the flags */
+    {
+        res = a_amg8833_status_handler(handle, prev);                                               /* handle the read status */
+        if (res != 0)                                                                               /* check result */
         {
-            raw[7 - i][7 - j] = (int16_t)(((uint16_t)buf[i * 16 + j * 2 + 1] << 8) |        /* get raw data */
-                                                     buf[i * 16 + j * 2 + 0]);              /* get raw data */
-            temp[7 - i][7 - j] = (float)raw[7 - i][7 - j] * 0.25f;                          /* get converted temperature */
+            return 1;                                                                               /* return error */
         }
     }
+    
+    return 0;                                                                                       /* success return 0 */
+}
 
-    return 0;                                                                               /* success return 0 */
+/**
+ * @brief      get the frame acquisition statistics
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *acquire pointer to an acquire structure
+ * @param[out] *frames pointer to a new frame number buffer
+ * @param[out] *duplicates pointer to a duplicate read number buffer
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t amg8833_acquire_get_statistics(amg8833_handle_t *handle, amg8833_acquire_t *acquire,
+                                       uint32_t *frames, uint32_t *duplicates, uint32_t *dropped)
+{
+    if (handle == NULL)                                                                             /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    
+    *frames = acquire->frames;                                                                      /* get the frame number */
+    *duplicates = acquire->duplicates;                                                              /* get the duplicate number */
+    *dropped = acquire->dropped;                                                                    /* get the dropped number */
+    
+    return 0;                                                                                       /* success return 0 */
 }
 
 /**
@@ -1357,6 +2350,8 @@ uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][
 uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1])
 {
     uint8_t res;
+    uint8_t i;
+    uint8_t buf[8];
     
     if (handle == NULL)                                                               /* check handle */
     {
@@ -1367,62 +2362,72 @@ uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1
         return 3;                                                                     /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)table[7], 1);       /* read int0 register */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("amg8833: read int0 register failed.\n");                 /* read int0 register failed */
-       
-        return 1;                                                                     /* return error */
-    }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT1, (uint8_t *)table[6], 1);       /* read int1 register */
-    if (res != 0)                                                                     /* check result */
-    {
-        handle->debug_print("amg8833: read int1 register failed.\n");                 /* read int1 register failed */
-       
-        return 1;                                                                     /* return error */
-    }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT2, (uint8_t *)table[5], 1);       /* read int2 register */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)buf, 8);            /* read int0 to int7 register */
     if (res != 0)                                                                     /* check result */
     {
-        handle->debug_print("amg8833: read int2 register failed.\n");                 /* read int2 register failed */
-       
+        handle->debug_print("amg8833: read int0 to int7 register failed.\n");         /* read int0 to int7 register failed */
+    
         return 1;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT3, (uint8_t *)table[4], 1);       /* read int3 register */
-    if (res != 0)                                                                     /* check result */
+    for (i = 0; i < 8; i++)                                                           /* run 8 times */
     {
-        handle->debug_print("amg8833: read int3 register failed.\n");                 /* read int3 register failed */
-       
-        return 1;                                                                     /* return error */
+        table[7 - i][0] = buf[i];                                                     /* set the table */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT4, (uint8_t *)table[3], 1);       /* read int4 register */
-    if (res != 0)                                                                     /* check result */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the interrupt mask
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *mask pointer to an interrupt mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       bit (row * 8 + col) is the pixel raw[row][col] in the handle orientation
+ */
+uint8_t amg8833_get_interrupt_mask(amg8833_handle_t *handle, uint64_t *mask)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    uint8_t buf[8];
+    int16_t index;
+    int16_t row_step;
+    int16_t col_step;
+    uint64_t m;
+    
+    if (handle == NULL)                                                               /* check handle */
     {
-        handle->debug_print("amg8833: read int4 register failed.\n");                 /* read int4 register failed */
-       
-        return 1;                                                                     /* return error */
+        return 2;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT5, (uint8_t *)table[2], 1);       /* read int5 register */
-    if (res != 0)                                                                     /* check result */
+    if (handle->inited != 1)                                                          /* check handle initialization */
     {
-        handle->debug_print("amg8833: read int5 register failed.\n");                 /* read int5 register failed */
-       
-        return 1;                                                                     /* return error */
+        return 3;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT6, (uint8_t *)table[1], 1);       /* read int6 register */
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)buf, 8);            /* read int0 to int7 register */
     if (res != 0)                                                                     /* check result */
     {
-        handle->debug_print("amg8833: read int6 register failed.\n");                 /* read int6 register failed */
-       
+        handle->debug_print("amg8833: read int0 to int7 register failed.\n");         /* read int0 to int7 register failed */
+    
         return 1;                                                                     /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT7, (uint8_t *)table[0], 1);       /* read int7 register */
-    if (res != 0)                                                                     /* check result */
+    m = 0;                                                                            /* init 0 */
+    row_step = g_amg8833_orientation_table[handle->orientation][1];                   /* get the row step */
+    col_step = g_amg8833_orientation_table[handle->orientation][2];                   /* get the column step */
+    for (i = 0; i < 8; i++)                                                           /* run 8 times */
     {
-        handle->debug_print("amg8833: read int7 register failed.\n");                 /* read int7 register failed */
-       
-        return 1;                                                                     /* return error */
+        index = g_amg8833_orientation_table[handle->orientation][0] + i * row_step;   /* get the row start */
+        for (j = 0; j < 8; j++)                                                       /* run 8 times */
+        {
+            m |= (uint64_t)((buf[i] >> j) & 0x01) << index;                           /* set the bit */
+            index += col_step;                                                        /* next column */
+        }
     }
+    *mask = m;                                                                        /* set the mask */
     
     return 0;                                                                         /* success return 0 */
 }
@@ -1438,7 +2443,7 @@ uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the register cache is invalidated
  */
 uint8_t amg8833_set_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
@@ -1451,6 +2456,8 @@ uint8_t amg8833_set_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uin
         return 3;                                            /* return error */
     }
     
+    handle->cache_valid = 0;                                 /* flag cache invalid */
+    
     return a_amg8833_iic_write(handle, reg, buf, len);       /* write data */
 }
 
@@ -1465,20 +2472,25 @@ uint8_t amg8833_set_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uin
  *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the register cache is bypassed
  */
 uint8_t amg8833_get_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle == NULL)                                     /* check handle */
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
     {
-        return 2;                                           /* return error */
+        return 3;                                                     /* return error */
     }
-    if (handle->inited != 1)                                /* check handle initialization */
+    
+    if (a_amg8833_bus_read(handle, reg, buf, len) != 0)               /* read data */
     {
-        return 3;                                           /* return error */
+        return 1;                                                     /* return error */
     }
     
-    return a_amg8833_iic_read(handle, reg, buf, len);       /* read data */
+    return 0;                                                         /* success return 0 */
 }
 
 /**
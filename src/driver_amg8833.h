@@ -131,6 +131,36 @@ typedef enum
     AMG8833_AVERAGE_MODE_TWICE = 0x01,        /**< twice moving average output mode */
 } amg8833_average_mode_t;
 
+/**
+ * @brief amg8833 fixed point enumeration definition
+ */
+typedef enum
+{
+    AMG8833_FIXED_POINT_Q2    = 0x00,        /**< 0.25C per lsb, same as the raw data */
+    AMG8833_FIXED_POINT_Q8    = 0x01,        /**< 1/256C per lsb */
+    AMG8833_FIXED_POINT_CENTI = 0x02,        /**< 0.01C per lsb */
+} amg8833_fixed_point_t;
+
+/**
+ * @brief amg8833 orientation enumeration definition
+ */
+typedef enum
+{
+    AMG8833_ORIENTATION_IDENTITY          = 0x00,        /**< default output, pixel_64 at the top left */
+    AMG8833_ORIENTATION_ROTATE_90         = 0x01,        /**< rotate 90 degrees clockwise */
+    AMG8833_ORIENTATION_ROTATE_180        = 0x02,        /**< rotate 180 degrees, pixel_01 at the top left */
+    AMG8833_ORIENTATION_ROTATE_270        = 0x03,        /**< rotate 270 degrees clockwise */
+    AMG8833_ORIENTATION_MIRROR_HORIZONTAL = 0x04,        /**< mirror left and right */
+    AMG8833_ORIENTATION_MIRROR_VERTICAL   = 0x05,        /**< mirror top and bottom */
+    AMG8833_ORIENTATION_TRANSPOSE         = 0x06,        /**< swap rows and columns */
+    AMG8833_ORIENTATION_ANTI_TRANSPOSE    = 0x07,        /**< swap rows and columns along the anti diagonal */
+} amg8833_orientation_t;
+
+/**
+ * @brief amg8833 register cache size definition
+ */
+#define AMG8833_CACHE_SIZE        14        /**< pctl to ihysh */
+
 /**
  * @brief amg8833 handle structure definition
  */
@@ -143,8 +173,24 @@ typedef struct amg8833_handle_s
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
     void (*receive_callback)(uint8_t type);                                             /**< point to a receive_callback function address */
+    uint8_t (*iic_init_ctx)(void *user);                                                /**< point to an iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *user);                                              /**< point to an iic_deinit_ctx function address */
+    uint8_t (*iic_read_ctx)(void *user, uint8_t addr, uint8_t reg,
+                            uint8_t *buf, uint16_t len);                                /**< point to an iic_read_ctx function address */
+    uint8_t (*iic_write_ctx)(void *user, uint8_t addr, uint8_t reg,
+                             uint8_t *buf, uint16_t len);                               /**< point to an iic_write_ctx function address */
+    void (*receive_callback_ctx)(void *user, uint8_t type);                             /**< point to a receive_callback_ctx function address */
+    void *user;                                                                         /**< user context */
     uint8_t inited;                                                                     /**< inited flag */
     uint8_t iic_addr;                                                                   /**< iic address */
+    uint8_t orientation;                                                                /**< pixel orientation */
+    uint8_t cache_enable;                                                               /**< register cache enable */
+    uint8_t cache_valid;                                                                /**< register cache valid flag */
+    uint8_t cache[AMG8833_CACHE_SIZE];                                                  /**< register cache */
+    uint32_t sequence;                                                                  /**< frame sequence number */
+    uint8_t change_detect;                                                              /**< frame change detection enable */
+    uint8_t frame_valid;                                                                /**< last frame valid flag */
+    uint8_t frame[128];                                                                 /**< last frame */
 } amg8833_handle_t;
 
 /**
@@ -163,6 +209,97 @@ typedef struct amg8833_info_s
     uint32_t driver_version;           /**< driver version */
 } amg8833_info_t;
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup amg8833_frame_driver amg8833 frame driver function
+ * @brief    amg8833 frame driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 frame buffer size definition
+ */
+#define AMG8833_FRAME_BUFFER_SIZE        128        /**< 64 pixels, 2 bytes per pixel */
+
+/**
+ * @brief     decode a 12 bits two's complement pixel output
+ * @param[in] H upper level register value
+ * @param[in] L lower level register value
+ * @note      branchless, bit 11 is flipped and subtracted to sign extend, 0.25C per lsb
+ */
+#define AMG8833_PIXEL_DECODE(H, L)               ((int16_t)((int16_t)((((uint16_t)((H) & 0x0F) << 8) | \
+                                                  (uint16_t)(L)) ^ 0x800) - 0x800))
+
+/**
+ * @brief     decode a 12 bits sign magnitude thermistor output
+ * @param[in] H upper level register value
+ * @param[in] L lower level register value
+ * @note      branchless, the magnitude is negated by (m ^ -s) + s with the sign bit s, 0.0625C per lsb
+ */
+#define AMG8833_THERMISTOR_DECODE(H, L)          ((int16_t)(((((uint16_t)((H) & 0x07) << 8) | (uint16_t)(L)) ^ \
+                                                  (-(int16_t)(((H) >> 3) & 0x01))) + (((H) >> 3) & 0x01)))
+
+/**
+ * @brief     get the pixel raw data from a frame buffer
+ * @param[in] BUF pointer to a frame buffer
+ * @param[in] N pixel index, 0 is pixel_01 and 63 is pixel_64
+ * @note      the result is the sign extended 12 bits raw data, 0.25C per lsb
+ */
+#define AMG8833_FRAME_PIXEL(BUF, N)              AMG8833_PIXEL_DECODE((BUF)[(N) * 2 + 1], (BUF)[(N) * 2 + 0])
+
+/**
+ * @brief     get the pixel raw data from a frame buffer by the row and the column
+ * @param[in] BUF pointer to a frame buffer
+ * @param[in] ROW row index
+ * @param[in] COL column index
+ * @note      the pixel order is the identity orientation of amg8833_read_temperature_array
+ */
+#define AMG8833_FRAME_PIXEL_AT(BUF, ROW, COL)    AMG8833_FRAME_PIXEL(BUF, 63 - (ROW) * 8 - (COL))
+
+/**
+ * @brief amg8833 orientation table, {base, row_step, col_step} indexed by amg8833_orientation_t
+ * @note  pixel (row, col) of the register order goes to index = base + row * row_step + col * col_step
+ */
+extern const int8_t g_amg8833_orientation_table[8][3];
+
+/**
+ * @brief amg8833 snapshot structure definition
+ */
+typedef struct amg8833_snapshot_s
+{
+    uint32_t sequence;          /**< sensor frame sequence number */
+    uint8_t status;             /**< stat register */
+    int16_t thermistor;         /**< thermistor temperature, 0.0625C per lsb */
+    int16_t raw[8][8];          /**< pixel raw data in the handle orientation, 0.25C per lsb */
+} amg8833_snapshot_t;
+
+/**
+ * @brief amg8833 acquire structure definition
+ * @note  all timestamps are in us and may wrap around
+ */
+typedef struct amg8833_acquire_s
+{
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];        /**< last frame buffer */
+    uint32_t nominal;                              /**< nominal frame period */
+    uint32_t period;                               /**< estimated frame period */
+    uint32_t step;                                 /**< search step */
+    uint32_t next;                                 /**< next read timestamp */
+    uint32_t last;                                 /**< last new frame timestamp */
+    uint32_t anchor;                               /**< last locked frame boundary timestamp */
+    uint32_t count;                                /**< frame periods since the anchor */
+    uint32_t frames;                               /**< new frame number */
+    uint32_t duplicates;                           /**< duplicate read number */
+    uint32_t dropped;                              /**< dropped frame number */
+    uint8_t valid;                                 /**< last frame valid flag */
+    uint8_t early;                                 /**< last read was a duplicate flag */
+    uint8_t probe;                                 /**< next read is a probe flag */
+    uint8_t locked;                                /**< phase locked flag */
+} amg8833_acquire_t;
+
 /**
  * @}
  */
@@ -238,6 +375,54 @@ typedef struct amg8833_info_s
  */
 #define DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(HANDLE, FUC)  (HANDLE)->receive_callback = FUC
 
+/**
+ * @brief     link iic_init_ctx function
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] FUC pointer to an iic_init_ctx function address
+ * @note      the context function is used instead of iic_init when it is linked
+ */
+#define DRIVER_AMG8833_LINK_IIC_INIT_CTX(HANDLE, FUC)          (HANDLE)->iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit_ctx function
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ctx function address
+ * @note      the context function is used instead of iic_deinit when it is linked
+ */
+#define DRIVER_AMG8833_LINK_IIC_DEINIT_CTX(HANDLE, FUC)        (HANDLE)->iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_read_ctx function
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] FUC pointer to an iic_read_ctx function address
+ * @note      the context function is used instead of iic_read when it is linked
+ */
+#define DRIVER_AMG8833_LINK_IIC_READ_CTX(HANDLE, FUC)          (HANDLE)->iic_read_ctx = FUC
+
+/**
+ * @brief     link iic_write_ctx function
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] FUC pointer to an iic_write_ctx function address
+ * @note      the context function is used instead of iic_write when it is linked
+ */
+#define DRIVER_AMG8833_LINK_IIC_WRITE_CTX(HANDLE, FUC)         (HANDLE)->iic_write_ctx = FUC
+
+/**
+ * @brief     link receive_callback_ctx function
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] FUC pointer to a receive_callback_ctx function address
+ * @note      the context function is used instead of receive_callback when it is linked
+ */
+#define DRIVER_AMG8833_LINK_RECEIVE_CALLBACK_CTX(HANDLE, FUC)  (HANDLE)->receive_callback_ctx = FUC
+
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an amg8833 handle structure
+ * @param[in] USER pointer to a user context
+ * @note      the user context is passed to all the context functions
+ */
+#define DRIVER_AMG8833_LINK_USER(HANDLE, USER)                 (HANDLE)->user = (void *)(USER)
+
 /**
  * @}
  */
@@ -293,6 +478,77 @@ uint8_t amg8833_set_addr_pin(amg8833_handle_t *handle, amg8833_address_t addr_pi
  */
 uint8_t amg8833_get_addr_pin(amg8833_handle_t *handle, amg8833_address_t *addr_pin);
 
+/**
+ * @brief     set the pixel orientation
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] orientation pixel orientation
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 orientation is invalid
+ * @note      the orientation is applied to all the temperature array outputs
+ */
+uint8_t amg8833_set_orientation(amg8833_handle_t *handle, amg8833_orientation_t orientation);
+
+/**
+ * @brief      get the pixel orientation
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *orientation pointer to a pixel orientation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_orientation(amg8833_handle_t *handle, amg8833_orientation_t *orientation);
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      pctl, fpsc, intc, ave and inthl to ihysh are shadowed in the handle,
+ *            so the setters need one write and the getters need no bus access,
+ *            the cache is filled by amg8833_init and refilled after a reset
+ */
+uint8_t amg8833_set_register_cache(amg8833_handle_t *handle, amg8833_bool_t enable);
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_register_cache(amg8833_handle_t *handle, amg8833_bool_t *enable);
+
+/**
+ * @brief     enable or disable the frame change detection
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      when enabled the temperature array reads compare the pixel registers with the last frame and
+ *            return 5 (frame not changed) without decoding when the whole buffer equals the last frame,
+ *            the output buffers are not touched then, except the buffer of amg8833_read_temperature_array_buffer
+ */
+uint8_t amg8833_set_frame_change_detect(amg8833_handle_t *handle, amg8833_bool_t enable);
+
+/**
+ * @brief      get the frame change detection status
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_frame_change_detect(amg8833_handle_t *handle, amg8833_bool_t *enable);
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to an amg8833 handle structure
@@ -343,6 +599,7 @@ uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *
  *             - 1 read temperature array failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
+ *             - 5 frame not changed
  * @note       pixel_64 pixel_63 ... pixel_57
  *             .                            .
  *             .                            .
@@ -350,9 +607,124 @@ uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *
  *             .                            .
  *             .                            .
  * @note       pixel_08 pixel_07 ... pixel_01
+ * @note       the figure shows the identity orientation, see amg8833_set_orientation
  */
 uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][8], float temp[8][8]);
 
+/**
+ * @brief      read the raw temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frame not changed
+ * @note       raw data is the sign extended 12 bits pixel output, 0.25C per lsb
+ * @note       the pixel order is the same as amg8833_read_temperature_array
+ */
+uint8_t amg8833_read_temperature_array_raw(amg8833_handle_t *handle, int16_t raw[8][8]);
+
+/**
+ * @brief      read the fixed point temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  format fixed point format
+ * @param[out] **temp pointer to a fixed point temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ *             - 5 frame not changed
+ * @note       no float operation is used
+ * @note       the pixel order is the same as amg8833_read_temperature_array
+ */
+uint8_t amg8833_read_temperature_array_fixed(amg8833_handle_t *handle, amg8833_fixed_point_t format, int32_t temp[8][8]);
+
+/**
+ * @brief      read the temperature array into a frame buffer
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *buf pointer to a frame buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read temperature array failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frame not changed
+ * @note       buf must be at least AMG8833_FRAME_BUFFER_SIZE bytes and is passed to the iic_read function directly
+ * @note       use AMG8833_FRAME_PIXEL or AMG8833_FRAME_PIXEL_AT to get the pixels
+ */
+uint8_t amg8833_read_temperature_array_buffer(amg8833_handle_t *handle, uint8_t *buf);
+
+/**
+ * @brief      read the status, the thermistor and the temperature array
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read snapshot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       stat to tthh and t01l to t64h are read in two transactions,
+ *             the sequence number starts from 0 after amg8833_init and increases by one whenever a snapshot or
+ *             a temperature array read of the handle gets a frame that differs from the last one, so snapshots
+ *             of the same sensor frame share one number and frames that are never read are not counted
+ */
+uint8_t amg8833_read_snapshot(amg8833_handle_t *handle, amg8833_snapshot_t *snapshot);
+
+/**
+ * @brief      init the frame acquisition
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *acquire pointer to an acquire structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 acquire init failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the nominal frame period is got from the frame rate register,
+ *             init it again after changing the frame rate
+ */
+uint8_t amg8833_acquire_init(amg8833_handle_t *handle, amg8833_acquire_t *acquire);
+
+/**
+ * @brief      read the next new frame with the phase locked acquisition
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *acquire pointer to an acquire structure
+ * @param[in]  timestamp current timestamp in us
+ * @param[out] *buf pointer to a frame buffer
+ * @param[out] *next pointer to a next read timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 acquire read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 frame is not ready
+ * @note       call it again at next, a call before next returns 4 without any bus transfer,
+ *             the chip has no data ready flag so the frame boundary is found by comparing the frames,
+ *             then the reads are locked just after the boundary and the period is tracked,
+ *             the stat register is checked after every new frame, a set flag is cleared and reported to the receive callback
+ */
+uint8_t amg8833_acquire_read(amg8833_handle_t *handle, amg8833_acquire_t *acquire, uint32_t timestamp,
+                             uint8_t *buf, uint32_t *next);
+
+/**
+ * @brief      get the frame acquisition statistics
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[in]  *acquire pointer to an acquire structure
+ * @param[out] *frames pointer to a new frame number buffer
+ * @param[out] *duplicates pointer to a duplicate read number buffer
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       duplicates are the reads before a frame boundary, dropped are the frames never read
+ */
+uint8_t amg8833_acquire_get_statistics(amg8833_handle_t *handle, amg8833_acquire_t *acquire,
+                                       uint32_t *frames, uint32_t *duplicates, uint32_t *dropped);
+
 /**
  * @brief      get the interrupt table
  * @param[in]  *handle pointer to an amg8833 handle structure
@@ -372,6 +744,20 @@ uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][
  */
 uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1]);
 
+/**
+ * @brief      get the interrupt mask
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *mask pointer to an interrupt mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       bit (row * 8 + col) is the pixel raw[row][col] in the handle orientation,
+ *             so the identity mask bit 63 - n is the interrupt flag of pixel_(n + 1)
+ */
+uint8_t amg8833_get_interrupt_mask(amg8833_handle_t *handle, uint64_t *mask);
+
 /**
  * @brief     set the mode
  * @param[in] *handle pointer to an amg8833 handle structure
@@ -619,6 +1005,36 @@ uint8_t amg8833_set_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t
  */
 uint8_t amg8833_get_interrupt_hysteresis_level(amg8833_handle_t *handle, int16_t *level);
 
+/**
+ * @brief     set the interrupt high, low and hysteresis levels
+ * @param[in] *handle pointer to an amg8833 handle structure
+ * @param[in] high interrupt high level
+ * @param[in] low interrupt low level
+ * @param[in] hysteresis interrupt hysteresis level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set interrupt levels failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      inthl to ihysh are written in one transaction
+ */
+uint8_t amg8833_set_interrupt_levels(amg8833_handle_t *handle, int16_t high, int16_t low, int16_t hysteresis);
+
+/**
+ * @brief      get the interrupt high, low and hysteresis levels
+ * @param[in]  *handle pointer to an amg8833 handle structure
+ * @param[out] *high pointer to an interrupt high level buffer
+ * @param[out] *low pointer to an interrupt low level buffer
+ * @param[out] *hysteresis pointer to an interrupt hysteresis level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt levels failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       inthl to ihysh are read in one transaction
+ */
+uint8_t amg8833_get_interrupt_levels(amg8833_handle_t *handle, int16_t *high, int16_t *low, int16_t *hysteresis);
+
 /**
  * @brief      convert the interrupt level to the register raw data
  * @param[in]  *handle pointer to an amg8833 handle structure
@@ -667,7 +1083,7 @@ uint8_t amg8833_interrupt_level_convert_to_data(amg8833_handle_t *handle, int16_
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the register cache is invalidated
  */
 uint8_t amg8833_set_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len);
 
@@ -682,7 +1098,7 @@ uint8_t amg8833_set_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uin
  *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the register cache is bypassed
  */
 uint8_t amg8833_get_reg(amg8833_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len);
 
@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_background.c
+ * @brief     driver amg8833 background source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_background.h"
+
+/**
+ * @brief     get the rounded step of a difference
+ * @param[in] d difference
+ * @param[in] n shift
+ * @return    step
+ * @note      d / 2^n is rounded half away from zero in both directions and a non zero difference
+ *            moves at least one 1/256 lsb, so the mean reaches the input from above and below
+ */
+static int64_t a_amg8833_background_step(int64_t d, int32_t n)
+{
+    int64_t step;
+    
+    if (d >= 0)                                                                                     /* positive difference */
+    {
+        step = (d + ((int64_t)1 << (n - 1))) >> n;                                                  /* round up */
+    }
+    else                                                                                            /* negative difference */
+    {
+        step = -((-d + ((int64_t)1 << (n - 1))) >> n);                                              /* round down */
+    }
+    if ((step == 0) && (d != 0))                                                                    /* less than half a step */
+    {
+        step = (d > 0) ? 1 : -1;                                                                    /* at least one unit */
+    }
+    
+    return step;                                                                                    /* return the step */
+}
+
+/**
+ * @brief     init the background model
+ * @param[in] *background pointer to a background structure
+ * @param[in] shift update shift
+ * @param[in] sigma foreground threshold
+ * @param[in] learn learning frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 background is NULL
+ * @note      none
+ */
+uint8_t amg8833_background_init(amg8833_background_t *background, uint8_t shift, uint8_t sigma, uint16_t learn)
+{
+    if (background == NULL)                                                                         /* check background */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if ((shift < 1) || (shift > 15))                                                                /* check shift */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    if ((sigma < 1) || (sigma > 15))                                                                /* check sigma */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    if (learn == 0)                                                                                 /* check learn */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    background->shift = shift;                                                                      /* set shift */
+    background->sigma = sigma;                                                                      /* set sigma */
+    background->learn = learn;                                                                      /* set learn */
+    
+    return amg8833_background_reset(background);                                                    /* reset the model */
+}
+
+/**
+ * @brief     reset the background model
+ * @param[in] *background pointer to a background structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ * @note      none
+ */
+uint8_t amg8833_background_reset(amg8833_background_t *background)
+{
+    uint8_t i;
+    
+    if (background == NULL)                                                                         /* check background */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+    {
+        background->mean[i] = 0;                                                                    /* clear mean */
+        background->variance[i] = AMG8833_BACKGROUND_MIN_VARIANCE;                                  /* set min variance */
+    }
+    background->mask = 0;                                                                           /* clear mask */
+    background->count = 0;                                                                          /* clear count */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      update the background model with a raw frame
+ * @param[in]  *background pointer to a background structure
+ * @param[in]  **raw pointer to a raw temperature frame
+ * @param[out] *mask pointer to a foreground mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ *             - 2 background is NULL
+ * @note       none
+ */
+uint8_t amg8833_background_update(amg8833_background_t *background, const int16_t raw[8][8], uint64_t *mask)
+{
+    uint8_t i;
+    int32_t n;
+    int32_t d;
+    int64_t d2;
+    int64_t v;
+    int64_t sigma2;
+    uint64_t fg;
+    const int16_t *src;
+    
+    if (background == NULL)                                                                         /* check background */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if ((raw == NULL) || (mask == NULL))                                                            /* check buffer */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    src = &raw[0][0];                                                                               /* get the input */
+    fg = 0;                                                                                         /* clear the mask */
+    if (background->count < background->learn)                                                      /* learning */
+    {
+        n = background->count + 1;                                                                  /* get the frame number */
+        for (i = 0; i < 64; i++)                                                                    /* run 64 times */
+        {
+            d = src[i] * 256 - background->mean[i];                                                 /* get the difference */
+            background->mean[i] += d / n;                                                           /* cumulative mean */
+            d2 = ((int64_t)d * (src[i] * 256 - background->mean[i])) >> 8;                          /* welford product */
+            v = background->variance[i];                                                            /* get the variance */
+            v += (d2 - v) / n;                                                                      /* cumulative variance */
+            if (v < AMG8833_BACKGROUND_MIN_VARIANCE)                                                /* check the min variance */
+            {
+                v = AMG8833_BACKGROUND_MIN_VARIANCE;                                                /* limit the variance */
+            }
+            background->variance[i] = (uint32_t)v;                                                  /* set the variance */
+        }
+        background->count++;                                                                        /* count the frame */
+    }
+    else
+    {
+        sigma2 = (int64_t)background->sigma * background->sigma;                                    /* squared threshold */
+        n = background->shift + AMG8833_BACKGROUND_FOREGROUND_SHIFT;                                /* foreground shift */
+        for (i = 0; i < 64; i++)                                                                    /* run 64 times */
+        {
+            d = src[i] * 256 - background->mean[i];                                                 /* get the difference */
+            d2 = ((int64_t)d * d) >> 8;                                                             /* squared difference */
+            v = background->variance[i];                                                            /* get the variance */
+            if (d2 > sigma2 * v)                                                                    /* check the foreground */
+            {
+                fg |= (uint64_t)1 << i;                                                             /* set the foreground */
+                background->mean[i] += (int32_t)a_amg8833_background_step(d, n);                    /* slowly move the mean */
+            }
+            else
+            {
+                background->mean[i] += (int32_t)a_amg8833_background_step(d, background->shift);    /* move the mean */
+                v += a_amg8833_background_step(d2 - v, background->shift);                          /* move the variance */
+                if (v < AMG8833_BACKGROUND_MIN_VARIANCE)                                            /* check the min variance */
+                {
+                    v = AMG8833_BACKGROUND_MIN_VARIANCE;                                            /* limit the variance */
+                }
+                background->variance[i] = (uint32_t)v;                                              /* set the variance */
+            }
+        }
+    }
+    background->mask = fg;                                                                          /* save the mask */
+    *mask = fg;                                                                                     /* set the mask */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the background mean
+ * @param[in]  *background pointer to a background structure
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mean failed
+ *             - 2 background is NULL
+ * @note       none
+ */
+uint8_t amg8833_background_get_mean(amg8833_background_t *background, int16_t raw[8][8])
+{
+    uint8_t i;
+    int16_t *dst;
+    
+    if (background == NULL)                                                                         /* check background */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (raw == NULL)                                                                                /* check buffer */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    dst = &raw[0][0];                                                                               /* get the output */
+    for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+    {
+        dst[i] = (int16_t)((background->mean[i] + 128) >> 8);                                       /* round to lsb */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
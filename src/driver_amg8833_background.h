@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_background.h
+ * @brief     driver amg8833 background header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_BACKGROUND_H
+#define DRIVER_AMG8833_BACKGROUND_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_background_driver amg8833 background driver function
+ * @brief    amg8833 background driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 background min variance definition
+ * @note  in 1/256 lsb^2, 1024 is a 2 lsb (0.5C) standard deviation
+ */
+#ifndef AMG8833_BACKGROUND_MIN_VARIANCE
+    #define AMG8833_BACKGROUND_MIN_VARIANCE 1024        /**< 0.5C */
+#endif
+
+/**
+ * @brief amg8833 background foreground shift definition
+ * @note  a foreground pixel moves 2^AMG8833_BACKGROUND_FOREGROUND_SHIFT times slower than a background pixel,
+ *        so a still warm object fades into the background instead of staying foreground forever
+ */
+#ifndef AMG8833_BACKGROUND_FOREGROUND_SHIFT
+    #define AMG8833_BACKGROUND_FOREGROUND_SHIFT 4        /**< 16 times slower */
+#endif
+
+/**
+ * @brief amg8833 background structure definition
+ */
+typedef struct amg8833_background_s
+{
+    int32_t mean[64];            /**< per pixel mean in 1/256 lsb */
+    uint32_t variance[64];       /**< per pixel variance in 1/256 lsb^2 */
+    uint64_t mask;               /**< last foreground mask */
+    uint16_t learn;              /**< learning frame number */
+    uint16_t count;              /**< learned frame number */
+    uint8_t shift;               /**< update shift */
+    uint8_t sigma;               /**< foreground threshold in standard deviations */
+} amg8833_background_t;
+
+/**
+ * @brief     init the background model
+ * @param[in] *background pointer to a background structure
+ * @param[in] shift update shift 1 - 15, a background pixel moves 1 / 2^shift of the way to the input every frame
+ * @param[in] sigma foreground threshold 1 - 15 in standard deviations
+ * @param[in] learn learning frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 background is NULL
+ * @note      learn must be over 0
+ */
+uint8_t amg8833_background_init(amg8833_background_t *background, uint8_t shift, uint8_t sigma, uint16_t learn);
+
+/**
+ * @brief     reset the background model
+ * @param[in] *background pointer to a background structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ * @note      the model learns again from the next frame
+ */
+uint8_t amg8833_background_reset(amg8833_background_t *background);
+
+/**
+ * @brief      update the background model with a raw frame
+ * @param[in]  *background pointer to a background structure
+ * @param[in]  **raw pointer to a raw temperature frame
+ * @param[out] *mask pointer to a foreground mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ *             - 2 background is NULL
+ * @note       bit (row * 8 + col) of the mask is raw[row][col],
+ *             the mask is 0 while learning, the foreground mean moves 2^AMG8833_BACKGROUND_FOREGROUND_SHIFT times
+ *             slower so people are not absorbed at once, the foreground variance is not updated,
+ *             every step is rounded and at least 1/256 lsb so the mean converges up and down at any shift
+ */
+uint8_t amg8833_background_update(amg8833_background_t *background, const int16_t raw[8][8], uint64_t *mask);
+
+/**
+ * @brief      get the background mean
+ * @param[in]  *background pointer to a background structure
+ * @param[out] **raw pointer to a raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get mean failed
+ *             - 2 background is NULL
+ * @note       none
+ */
+uint8_t amg8833_background_get_mean(amg8833_background_t *background, int16_t raw[8][8]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_blob.c
+ * @brief     driver amg8833 blob source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_blob.h"
+
+/**
+ * @brief column mask definition
+ */
+#define AMG8833_BLOB_NOT_COL0        0xFEFEFEFEFEFEFEFEULL        /**< all columns except column 0 */
+#define AMG8833_BLOB_NOT_COL7        0x7F7F7F7F7F7F7F7FULL        /**< all columns except column 7 */
+
+/**
+ * @brief     grow a mask by one pixel in the 8 directions
+ * @param[in] mask pixel mask
+ * @return    grown mask
+ * @note      none
+ */
+static uint64_t a_amg8833_blob_grow(uint64_t mask)
+{
+    uint64_t h;
+    
+    h = mask | ((mask << 1) & AMG8833_BLOB_NOT_COL0) | ((mask >> 1) & AMG8833_BLOB_NOT_COL7);                 /* grow the columns */
+    
+    return h | (h << 8) | (h >> 8);                                                                           /* grow the rows */
+}
+
+/**
+ * @brief      convert an interrupt table to a mask
+ * @param[in]  **table pointer to an interrupt table from amg8833_get_interrupt_table
+ * @param[out] *mask pointer to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       none
+ */
+uint8_t amg8833_blob_mask_from_table(const uint8_t table[8][1], uint64_t *mask)
+{
+    uint8_t r;
+    uint8_t c;
+    uint64_t m;
+    
+    if ((table == NULL) || (mask == NULL))                                                                    /* check buffer */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    
+    m = 0;                                                                                                    /* clear the mask */
+    for (r = 0; r < 8; r++)                                                                                   /* run 8 times */
+    {
+        for (c = 0; c < 8; c++)                                                                               /* run 8 times */
+        {
+            if ((table[r][0] & (1 << c)) != 0)                                                                /* pixel (7 - c) of the row */
+            {
+                m |= (uint64_t)1 << (r * 8 + 7 - c);                                                          /* set the bit */
+            }
+        }
+    }
+    *mask = m;                                                                                                /* set the mask */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief         extract the 8-connected blobs of a mask
+ * @param[in]     mask pixel mask
+ * @param[in]     **raw pointer to a raw temperature frame
+ * @param[in]     base weight base
+ * @param[out]    *blob pointer to a blob array
+ * @param[in,out] *num pointer to a blob number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ * @note          none
+ */
+uint8_t amg8833_blob_extract(uint64_t mask, const int16_t raw[8][8], int16_t base, amg8833_blob_t *blob, uint8_t *num)
+{
+    uint8_t i;
+    uint8_t n;
+    uint64_t comp;
+    uint64_t prev;
+    int32_t w;
+    int32_t sx;
+    int32_t sy;
+    int32_t swx;
+    int32_t swy;
+    amg8833_blob_t *b;
+    
+    if ((raw == NULL) || (blob == NULL) || (num == NULL))                                                     /* check buffer */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    
+    n = 0;                                                                                                    /* no blob */
+    while ((mask != 0) && (n < *num))                                                                         /* until all pixels are labeled */
+    {
+        comp = mask & (~mask + 1);                                                                            /* seed with the lowest pixel */
+        do
+        {
+            prev = comp;                                                                                      /* save the component */
+            comp = a_amg8833_blob_grow(comp) & mask;                                                          /* grow inside the mask */
+        } while (comp != prev);                                                                               /* until stable */
+        mask &= ~comp;                                                                                        /* remove the component */
+        
+        b = &blob[n];                                                                                         /* get the blob */
+        b->mask = comp;                                                                                       /* set the mask */
+        b->size = 0;                                                                                          /* clear the size */
+        b->peak = INT16_MIN;                                                                                  /* clear the peak */
+        b->weight = 0;                                                                                        /* clear the weight */
+        sx = 0;                                                                                               /* clear the sum */
+        sy = 0;                                                                                               /* clear the sum */
+        swx = 0;                                                                                              /* clear the weighted sum */
+        swy = 0;                                                                                              /* clear the weighted sum */
+        for (i = 0; i < 64; i++)                                                                              /* run 64 times */
+        {
+            if ((comp & ((uint64_t)1 << i)) == 0)                                                             /* not in the blob */
+            {
+                continue;                                                                                     /* next pixel */
+            }
+            w = raw[i / 8][i % 8] - base;                                                                     /* get the weight */
+            if (w < 1)                                                                                        /* check the weight */
+            {
+                w = 1;                                                                                        /* at least 1 */
+            }
+            if (raw[i / 8][i % 8] > b->peak)                                                                  /* check the peak */
+            {
+                b->peak = raw[i / 8][i % 8];                                                                  /* set the peak */
+            }
+            sx += i % 8;                                                                                      /* sum the column */
+            sy += i / 8;                                                                                      /* sum the row */
+            swx += w * (i % 8);                                                                               /* sum the weighted column */
+            swy += w * (i / 8);                                                                               /* sum the weighted row */
+            b->weight += w;                                                                                   /* sum the weight */
+            b->size++;                                                                                        /* count the pixel */
+        }
+        b->x = (int16_t)((sx * 256) / b->size);                                                               /* centroid column */
+        b->y = (int16_t)((sy * 256) / b->size);                                                               /* centroid row */
+        b->wx = (int16_t)(((int64_t)swx * 256) / b->weight);                                                  /* weighted centroid column */
+        b->wy = (int16_t)(((int64_t)swy * 256) / b->weight);                                                  /* weighted centroid row */
+        n++;                                                                                                  /* next blob */
+    }
+    *num = n;                                                                                                 /* set the blob number */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     init the tracker
+ * @param[in] *tracker pointer to a tracker structure
+ * @param[in] gate max association distance in pixels
+ * @param[in] max_missed frames a track is kept without a blob
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 tracker is NULL
+ * @note      none
+ */
+uint8_t amg8833_tracker_init(amg8833_tracker_t *tracker, uint8_t gate, uint8_t max_missed)
+{
+    uint8_t i;
+    
+    if (tracker == NULL)                                                                                      /* check tracker */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if ((gate < 1) || (gate > 8))                                                                             /* check gate */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    
+    for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                              /* clear all tracks */
+    {
+        memset(&tracker->track[i], 0, sizeof(amg8833_track_t));                                               /* clear the track */
+    }
+    tracker->gate = (int32_t)gate * 256 * gate * 256;                                                         /* set the squared gate */
+    tracker->next_id = 1;                                                                                     /* ids start from 1 */
+    tracker->max_missed = max_missed;                                                                         /* set max missed */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     update the tracker with the blobs of a frame
+ * @param[in] *tracker pointer to a tracker structure
+ * @param[in] *blob pointer to a blob array
+ * @param[in] num blob number
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 2 tracker is NULL
+ * @note      none
+ */
+uint8_t amg8833_tracker_update(amg8833_tracker_t *tracker, const amg8833_blob_t *blob, uint8_t num)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t bi;
+    uint8_t bj;
+    uint32_t track_used;
+    uint32_t blob_used;
+    int32_t dx;
+    int32_t dy;
+    int32_t d2;
+    int32_t best;
+    amg8833_track_t *t;
+    
+    if (tracker == NULL)                                                                                      /* check tracker */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if ((blob == NULL) && (num != 0))                                                                         /* check buffer */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    if (num > AMG8833_BLOB_MAX)                                                                               /* check num */
+    {
+        num = AMG8833_BLOB_MAX;                                                                               /* limit the blob number */
+    }
+    
+    track_used = 0;                                                                                           /* no matched track */
+    blob_used = 0;                                                                                            /* no matched blob */
+    while (1)                                                                                                 /* greedy association */
+    {
+        best = tracker->gate + 1;                                                                             /* out of the gate */
+        bi = 0;                                                                                               /* init index */
+        bj = 0;                                                                                               /* init index */
+        for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                          /* all tracks */
+        {
+            t = &tracker->track[i];                                                                           /* get the track */
+            if ((t->id == 0) || ((track_used & (1UL << i)) != 0))                                             /* skip unused and matched tracks */
+            {
+                continue;                                                                                     /* next track */
+            }
+            for (j = 0; j < num; j++)                                                                         /* all blobs */
+            {
+                if ((blob_used & (1UL << j)) != 0)                                                            /* skip matched blobs */
+                {
+                    continue;                                                                                 /* next blob */
+                }
+                dx = blob[j].wx - (t->x + t->vx);                                                             /* column distance to the prediction */
+                dy = blob[j].wy - (t->y + t->vy);                                                             /* row distance to the prediction */
+                d2 = dx * dx + dy * dy;                                                                       /* squared distance */
+                if (d2 < best)                                                                                /* check the best */
+                {
+                    best = d2;                                                                                /* save the distance */
+                    bi = i;                                                                                   /* save the track */
+                    bj = j;                                                                                   /* save the blob */
+                }
+            }
+        }
+        if (best > tracker->gate)                                                                             /* no pair in the gate */
+        {
+            break;                                                                                            /* break */
+        }
+        
+        t = &tracker->track[bi];                                                                              /* get the track */
+        t->px = t->x;                                                                                         /* save the column */
+        t->py = t->y;                                                                                         /* save the row */
+        t->vx = (int16_t)((t->vx + (blob[bj].wx - t->x)) / 2);                                                /* smooth the column velocity */
+        t->vy = (int16_t)((t->vy + (blob[bj].wy - t->y)) / 2);                                                /* smooth the row velocity */
+        t->x = blob[bj].wx;                                                                                   /* set the column */
+        t->y = blob[bj].wy;                                                                                   /* set the row */
+        t->size = blob[bj].size;                                                                              /* set the size */
+        t->missed = 0;                                                                                        /* clear missed */
+        if (t->age < 255)                                                                                     /* check the age */
+        {
+            t->age++;                                                                                         /* age the track */
+        }
+        track_used |= 1UL << bi;                                                                              /* mark the track */
+        blob_used |= 1UL << bj;                                                                               /* mark the blob */
+    }
+    
+    for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                              /* unmatched tracks */
+    {
+        t = &tracker->track[i];                                                                               /* get the track */
+        if ((t->id == 0) || ((track_used & (1UL << i)) != 0))                                                 /* skip unused and matched tracks */
+        {
+            continue;                                                                                         /* next track */
+        }
+        if (t->missed >= tracker->max_missed)                                                                 /* check missed */
+        {
+            t->id = 0;                                                                                        /* free the track */
+            
+            continue;                                                                                         /* next track */
+        }
+        t->missed++;                                                                                          /* count missed */
+        t->px = t->x;                                                                                         /* save the column */
+        t->py = t->y;                                                                                         /* save the row */
+        t->x = (int16_t)(t->x + t->vx);                                                                       /* coast the column */
+        t->y = (int16_t)(t->y + t->vy);                                                                       /* coast the row */
+    }
+    
+    for (j = 0; j < num; j++)                                                                                 /* unmatched blobs */
+    {
+        if ((blob_used & (1UL << j)) != 0)                                                                    /* skip matched blobs */
+        {
+            continue;                                                                                         /* next blob */
+        }
+        for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                          /* find a free slot */
+        {
+            if (tracker->track[i].id == 0)                                                                    /* check free */
+            {
+                break;                                                                                        /* break */
+            }
+        }
+        if (i == AMG8833_BLOB_MAX_TRACK)                                                                      /* no free slot */
+        {
+            break;                                                                                            /* break */
+        }
+        t = &tracker->track[i];                                                                               /* get the track */
+        t->id = tracker->next_id;                                                                             /* set the id */
+        tracker->next_id++;                                                                                   /* next id */
+        if (tracker->next_id == 0)                                                                            /* skip 0 */
+        {
+            tracker->next_id = 1;                                                                             /* wrap to 1 */
+        }
+        t->age = 1;                                                                                           /* first frame */
+        t->missed = 0;                                                                                        /* clear missed */
+        t->x = blob[j].wx;                                                                                    /* set the column */
+        t->y = blob[j].wy;                                                                                    /* set the row */
+        t->px = blob[j].wx;                                                                                   /* no previous column */
+        t->py = blob[j].wy;                                                                                   /* no previous row */
+        t->vx = 0;                                                                                            /* no velocity */
+        t->vy = 0;                                                                                            /* no velocity */
+        t->size = blob[j].size;                                                                               /* set the size */
+    }
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief         get the active tracks
+ * @param[in]     *tracker pointer to a tracker structure
+ * @param[out]    *track pointer to a track array
+ * @param[in,out] *num pointer to a track number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ *                - 2 tracker is NULL
+ * @note          none
+ */
+uint8_t amg8833_tracker_get_tracks(amg8833_tracker_t *tracker, amg8833_track_t *track, uint8_t *num)
+{
+    uint8_t i;
+    uint8_t n;
+    
+    if (tracker == NULL)                                                                                      /* check tracker */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if ((track == NULL) || (num == NULL))                                                                     /* check buffer */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    
+    n = 0;                                                                                                    /* no track */
+    for (i = 0; (i < AMG8833_BLOB_MAX_TRACK) && (n < *num); i++)                                              /* all tracks */
+    {
+        if (tracker->track[i].id != 0)                                                                        /* check active */
+        {
+            track[n] = tracker->track[i];                                                                     /* copy the track */
+            n++;                                                                                              /* next track */
+        }
+    }
+    *num = n;                                                                                                 /* set the track number */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_blob.h
+ * @brief     driver amg8833 blob header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_BLOB_H
+#define DRIVER_AMG8833_BLOB_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_blob_driver amg8833 blob driver function
+ * @brief    amg8833 blob driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 blob max number definition
+ * @note  16 is the most 8-connected blobs an 8 x 8 mask can hold, at most 32
+ */
+#ifndef AMG8833_BLOB_MAX
+    #define AMG8833_BLOB_MAX 16        /**< 16 blobs */
+#endif
+
+/**
+ * @brief amg8833 blob max track number definition
+ * @note  at most 32
+ */
+#ifndef AMG8833_BLOB_MAX_TRACK
+    #define AMG8833_BLOB_MAX_TRACK 8        /**< 8 tracks */
+#endif
+
+/**
+ * @brief amg8833 blob structure definition
+ * @note  the positions are in 1/256 pixel, x is the column and y is the row
+ */
+typedef struct amg8833_blob_s
+{
+    uint64_t mask;          /**< blob pixels, bit (row * 8 + col) */
+    int32_t weight;         /**< sum of the pixel weights */
+    int16_t x;              /**< centroid column */
+    int16_t y;              /**< centroid row */
+    int16_t wx;             /**< weighted centroid column */
+    int16_t wy;             /**< weighted centroid row */
+    int16_t peak;           /**< peak raw data */
+    uint8_t size;           /**< pixel number */
+} amg8833_blob_t;
+
+/**
+ * @brief amg8833 track structure definition
+ * @note  the positions are in 1/256 pixel, x is the column and y is the row
+ */
+typedef struct amg8833_track_s
+{
+    uint16_t id;            /**< stable track id, 0 is unused */
+    uint8_t age;            /**< matched frame number, saturated at 255 */
+    uint8_t missed;         /**< continuous missed frame number */
+    int16_t x;              /**< current column */
+    int16_t y;              /**< current row */
+    int16_t px;             /**< previous column */
+    int16_t py;             /**< previous row */
+    int16_t vx;             /**< column velocity per frame */
+    int16_t vy;             /**< row velocity per frame */
+    uint8_t size;           /**< last blob pixel number */
+} amg8833_track_t;
+
+/**
+ * @brief amg8833 tracker structure definition
+ */
+typedef struct amg8833_tracker_s
+{
+    amg8833_track_t track[AMG8833_BLOB_MAX_TRACK];        /**< track table */
+    int32_t gate;                                         /**< squared association distance */
+    uint16_t next_id;                                     /**< next track id */
+    uint8_t max_missed;                                   /**< max missed frame number */
+} amg8833_tracker_t;
+
+/**
+ * @brief      convert an interrupt table to a mask
+ * @param[in]  **table pointer to an interrupt table from amg8833_get_interrupt_table
+ * @param[out] *mask pointer to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       bit (row * 8 + col) of the mask is raw[row][col] of amg8833_read_temperature_array in the identity orientation
+ */
+uint8_t amg8833_blob_mask_from_table(const uint8_t table[8][1], uint64_t *mask);
+
+/**
+ * @brief         extract the 8-connected blobs of a mask
+ * @param[in]     mask pixel mask, bit (row * 8 + col)
+ * @param[in]     **raw pointer to a raw temperature frame
+ * @param[in]     base weight base, a pixel weighs raw - base and at least 1
+ * @param[out]    *blob pointer to a blob array
+ * @param[in,out] *num pointer to a blob number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ * @note          num is the array size as input and the blob number as output,
+ *                blobs over the array size are not reported, the time is bounded by the 64 pixels
+ */
+uint8_t amg8833_blob_extract(uint64_t mask, const int16_t raw[8][8], int16_t base, amg8833_blob_t *blob, uint8_t *num);
+
+/**
+ * @brief     init the tracker
+ * @param[in] *tracker pointer to a tracker structure
+ * @param[in] gate max association distance in pixels, 1 - 8
+ * @param[in] max_missed frames a track is kept without a blob
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 tracker is NULL
+ * @note      none
+ */
+uint8_t amg8833_tracker_init(amg8833_tracker_t *tracker, uint8_t gate, uint8_t max_missed);
+
+/**
+ * @brief     update the tracker with the blobs of a frame
+ * @param[in] *tracker pointer to a tracker structure
+ * @param[in] *blob pointer to a blob array
+ * @param[in] num blob number
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 2 tracker is NULL
+ * @note      the blobs are greedily matched to the predicted tracks by the weighted centroid distance,
+ *            unmatched tracks coast on their velocity and unmatched blobs start new tracks while slots are free
+ */
+uint8_t amg8833_tracker_update(amg8833_tracker_t *tracker, const amg8833_blob_t *blob, uint8_t num);
+
+/**
+ * @brief         get the active tracks
+ * @param[in]     *tracker pointer to a tracker structure
+ * @param[out]    *track pointer to a track array
+ * @param[in,out] *num pointer to a track number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ *                - 2 tracker is NULL
+ * @note          num is the array size as input and the track number as output
+ */
+uint8_t amg8833_tracker_get_tracks(amg8833_tracker_t *tracker, amg8833_track_t *track, uint8_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_counter.c
+ * @brief     driver amg8833 counter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_counter.h"
+
+/**
+ * @brief     get the line side of a position
+ * @param[in] *config pointer to a config structure
+ * @param[in] *track pointer to a track structure
+ * @return    side
+ *            - -1 before the dead band
+ *            - 0 inside the dead band
+ *            - 1 after the dead band
+ * @note      none
+ */
+static int8_t a_amg8833_counter_side(const amg8833_counter_config_t *config, const amg8833_track_t *track)
+{
+    int32_t pos;
+    
+    pos = (config->axis == AMG8833_COUNTER_AXIS_ROW) ? track->y : track->x;                             /* get the position */
+    if (pos < (int32_t)config->line - config->band)                                                     /* before the band */
+    {
+        return -1;                                                                                      /* return -1 */
+    }
+    if (pos > (int32_t)config->line + config->band)                                                     /* after the band */
+    {
+        return 1;                                                                                       /* return 1 */
+    }
+    
+    return 0;                                                                                           /* return 0 */
+}
+
+/**
+ * @brief      get the default counter config
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config is NULL
+ * @note       none
+ */
+uint8_t amg8833_counter_get_default_config(amg8833_counter_config_t *config)
+{
+    if (config == NULL)                                                                                 /* check config */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    config->roi = 0xFFFFFFFFFFFFFFFFULL;                                                                /* the whole frame */
+    config->line = 896;                                                                                 /* row 3.5 */
+    config->band = 128;                                                                                 /* 0.5 pixel */
+    config->axis = AMG8833_COUNTER_AXIS_ROW;                                                            /* row line */
+    config->min_size = 2;                                                                               /* 2 pixels */
+    config->sigma = 3;                                                                                  /* 3 standard deviations */
+    config->shift = 6;                                                                                  /* 1 / 64 */
+    config->learn = 20;                                                                                 /* 20 frames */
+    config->gate = 3;                                                                                   /* 3 pixels */
+    config->max_missed = 3;                                                                             /* 3 frames */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     init the counter
+ * @param[in] *counter pointer to a counter structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 counter is NULL
+ * @note      none
+ */
+uint8_t amg8833_counter_init(amg8833_counter_t *counter, const amg8833_counter_config_t *config)
+{
+    uint8_t res;
+    uint8_t i;
+    
+    if (counter == NULL)                                                                                /* check counter */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (config == NULL)                                                                                 /* check config */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    if ((config->axis > AMG8833_COUNTER_AXIS_COLUMN) || (config->band < 0))                             /* check geometry */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    res = amg8833_background_init(&counter->background, config->shift, config->sigma, config->learn);   /* init the background */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    res = amg8833_tracker_init(&counter->tracker, config->gate, config->max_missed);                    /* init the tracker */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                        /* clear all slots */
+    {
+        counter->id[i] = 0;                                                                             /* clear the id */
+        counter->side[i] = 0;                                                                           /* clear the side */
+    }
+    counter->config = *config;                                                                          /* save the config */
+    counter->in = 0;                                                                                    /* clear in */
+    counter->out = 0;                                                                                   /* clear out */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     feed a raw frame to the counter
+ * @param[in] *counter pointer to a counter structure
+ * @param[in] **raw pointer to a raw temperature frame
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 2 counter is NULL
+ * @note      none
+ */
+uint8_t amg8833_counter_update(amg8833_counter_t *counter, const int16_t raw[8][8])
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t n;
+    uint8_t num;
+    int8_t side;
+    int32_t base;
+    uint64_t mask;
+    amg8833_track_t *t;
+    
+    if (counter == NULL)                                                                                /* check counter */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (raw == NULL)                                                                                    /* check buffer */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    res = amg8833_background_update(&counter->background, raw, &mask);                                  /* update the background */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    mask &= counter->config.roi;                                                                        /* keep the doorway */
+    base = 0;                                                                                           /* init base */
+    for (i = 0; i < 64; i++)                                                                            /* run 64 times */
+    {
+        base += counter->background.mean[i];                                                            /* sum the background */
+    }
+    base = (base / 64 + 128) >> 8;                                                                      /* background average in lsb */
+    num = AMG8833_BLOB_MAX;                                                                             /* blob array size */
+    res = amg8833_blob_extract(mask, raw, (int16_t)base, counter->blob, &num);                          /* extract the blobs */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    n = 0;                                                                                              /* init the kept number */
+    for (i = 0; i < num; i++)                                                                           /* drop the small blobs */
+    {
+        if (counter->blob[i].size >= counter->config.min_size)                                          /* check the size */
+        {
+            counter->blob[n] = counter->blob[i];                                                        /* keep the blob */
+            n++;                                                                                        /* next blob */
+        }
+    }
+    res = amg8833_tracker_update(&counter->tracker, counter->blob, n);                                  /* update the tracker */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    for (i = 0; i < AMG8833_BLOB_MAX_TRACK; i++)                                                        /* check all slots */
+    {
+        t = &counter->tracker.track[i];                                                                 /* get the track */
+        if (t->id == 0)                                                                                 /* free slot */
+        {
+            counter->id[i] = 0;                                                                         /* clear the id */
+            
+            continue;                                                                                   /* next slot */
+        }
+        side = a_amg8833_counter_side(&counter->config, t);                                             /* get the side */
+        if (counter->id[i] != t->id)                                                                    /* new track */
+        {
+            counter->id[i] = t->id;                                                                     /* save the id */
+            counter->side[i] = side;                                                                    /* save the start side */
+            
+            continue;                                                                                   /* next slot */
+        }
+        if ((t->missed != 0) || (side == 0) || (side == counter->side[i]))                              /* no crossing */
+        {
+            continue;                                                                                   /* next slot */
+        }
+        if (counter->side[i] == 0)                                                                      /* born in the dead band */
+        {
+            counter->side[i] = side;                                                                    /* the first side is the origin */
+            
+            continue;                                                                                   /* next slot */
+        }
+        if (side > 0)                                                                                   /* from before to after */
+        {
+            counter->in++;                                                                              /* count in */
+        }
+        else
+        {
+            counter->out++;                                                                             /* count out */
+        }
+        counter->side[i] = side;                                                                        /* save the side */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the in and out counts
+ * @param[in]  *counter pointer to a counter structure
+ * @param[out] *in pointer to an in count buffer
+ * @param[out] *out pointer to an out count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get count failed
+ *             - 2 counter is NULL
+ * @note       none
+ */
+uint8_t amg8833_counter_get_count(amg8833_counter_t *counter, uint32_t *in, uint32_t *out)
+{
+    if (counter == NULL)                                                                                /* check counter */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if ((in == NULL) || (out == NULL))                                                                  /* check buffer */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    
+    *in = counter->in;                                                                                  /* get in */
+    *out = counter->out;                                                                                /* get out */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     clear the in and out counts
+ * @param[in] *counter pointer to a counter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 counter is NULL
+ * @note      none
+ */
+uint8_t amg8833_counter_clear_count(amg8833_counter_t *counter)
+{
+    if (counter == NULL)                                                                                /* check counter */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    
+    counter->in = 0;                                                                                    /* clear in */
+    counter->out = 0;                                                                                   /* clear out */
+    
+    return 0;                                                                                           /* success return 0 */
+}
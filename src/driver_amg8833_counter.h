@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_counter.h
+ * @brief     driver amg8833 counter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_COUNTER_H
+#define DRIVER_AMG8833_COUNTER_H
+
+#include "driver_amg8833_background.h"
+#include "driver_amg8833_blob.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_counter_driver amg8833 counter driver function
+ * @brief    amg8833 counter driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 counter axis enumeration definition
+ */
+typedef enum
+{
+    AMG8833_COUNTER_AXIS_ROW    = 0x00,        /**< the line is a row position, in is the row increasing direction */
+    AMG8833_COUNTER_AXIS_COLUMN = 0x01,        /**< the line is a column position, in is the column increasing direction */
+} amg8833_counter_axis_t;
+
+/**
+ * @brief amg8833 counter config structure definition
+ * @note  the positions are in 1/256 pixel of raw[row][col]
+ */
+typedef struct amg8833_counter_config_s
+{
+    uint64_t roi;                /**< doorway pixel mask, bit (row * 8 + col) */
+    int16_t line;                /**< counting line position */
+    int16_t band;                /**< half width of the dead band around the line */
+    uint8_t axis;                /**< counting axis */
+    uint8_t min_size;            /**< min blob pixel number */
+    uint8_t sigma;               /**< background foreground threshold */
+    uint8_t shift;               /**< background update shift */
+    uint16_t learn;              /**< background learning frame number */
+    uint8_t gate;                /**< tracker gate in pixels */
+    uint8_t max_missed;          /**< tracker max missed frame number */
+} amg8833_counter_config_t;
+
+/**
+ * @brief amg8833 counter structure definition
+ */
+typedef struct amg8833_counter_s
+{
+    amg8833_background_t background;                  /**< background model */
+    amg8833_tracker_t tracker;                        /**< tracker */
+    amg8833_blob_t blob[AMG8833_BLOB_MAX];            /**< blob buffer */
+    uint16_t id[AMG8833_BLOB_MAX_TRACK];              /**< track id of every slot */
+    int8_t side[AMG8833_BLOB_MAX_TRACK];              /**< line side of every slot */
+    amg8833_counter_config_t config;                  /**< config */
+    uint32_t in;                                      /**< in count */
+    uint32_t out;                                     /**< out count */
+} amg8833_counter_t;
+
+/**
+ * @brief      get the default counter config
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config is NULL
+ * @note       the whole frame, a row line at 3.5 with a 0.5 pixel dead band
+ */
+uint8_t amg8833_counter_get_default_config(amg8833_counter_config_t *config);
+
+/**
+ * @brief     init the counter
+ * @param[in] *counter pointer to a counter structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 counter is NULL
+ * @note      none
+ */
+uint8_t amg8833_counter_init(amg8833_counter_t *counter, const amg8833_counter_config_t *config);
+
+/**
+ * @brief     feed a raw frame to the counter
+ * @param[in] *counter pointer to a counter structure
+ * @param[in] **raw pointer to a raw temperature frame
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 2 counter is NULL
+ * @note      the input is the raw output of amg8833_read_temperature_array,
+ *            a track is counted when it moves from one side of the dead band to the other,
+ *            a track born in the dead band takes the first side it reaches as its origin
+ */
+uint8_t amg8833_counter_update(amg8833_counter_t *counter, const int16_t raw[8][8]);
+
+/**
+ * @brief      get the in and out counts
+ * @param[in]  *counter pointer to a counter structure
+ * @param[out] *in pointer to an in count buffer
+ * @param[out] *out pointer to an out count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get count failed
+ *             - 2 counter is NULL
+ * @note       none
+ */
+uint8_t amg8833_counter_get_count(amg8833_counter_t *counter, uint32_t *in, uint32_t *out);
+
+/**
+ * @brief     clear the in and out counts
+ * @param[in] *counter pointer to a counter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 counter is NULL
+ * @note      none
+ */
+uint8_t amg8833_counter_clear_count(amg8833_counter_t *counter);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
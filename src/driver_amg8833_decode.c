@@ -0,0 +1,622 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_decode.c
+ * @brief     driver amg8833 decode source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_decode.h"
+
+/**
+ * @brief simd definition
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define AMG8833_DECODE_X86        /**< x86 paths */
+    #include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define AMG8833_DECODE_NEON       /**< neon path */
+    #include <arm_neon.h>
+#endif
+
+/**
+ * @brief decode path function definition
+ */
+typedef struct a_amg8833_decode_ops_s
+{
+    void (*extend)(const uint8_t *buf, int16_t *out, uint8_t reverse);        /**< sign extend 64 pixels */
+    void (*fixed)(const int16_t *in, int32_t *out, int16_t scale);            /**< widen and scale 64 pixels */
+    void (*real)(const int16_t *in, float *out);                              /**< convert 64 pixels */
+} a_amg8833_decode_ops_t;
+
+/**
+ * @brief     scalar sign extend
+ * @param[in] *buf pointer to a frame buffer
+ * @param[out] *out pointer to 64 pixels
+ * @param[in] reverse reverse the pixel order
+ * @note      none
+ */
+static void a_amg8833_decode_extend_scalar(const uint8_t *buf, int16_t *out, uint8_t reverse)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+    {
+        out[(reverse != 0) ? (63 - i) : i] = AMG8833_FRAME_PIXEL(buf, i);                           /* set the pixel */
+    }
+}
+
+/**
+ * @brief      scalar widen and scale
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 fixed point pixels
+ * @param[in]  scale scale
+ * @note       none
+ */
+static void a_amg8833_decode_fixed_scalar(const int16_t *in, int32_t *out, int16_t scale)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+    {
+        out[i] = (int32_t)in[i] * scale;                                                            /* scale */
+    }
+}
+
+/**
+ * @brief      scalar convert
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 float pixels
+ * @note       none
+ */
+static void a_amg8833_decode_real_scalar(const int16_t *in, float *out)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+    {
+        out[i] = (float)in[i] * 0.25f;                                                              /* convert */
+    }
+}
+
+/**
+ * @brief scalar path definition
+ */
+static const a_amg8833_decode_ops_t gs_decode_scalar =
+{
+    a_amg8833_decode_extend_scalar,
+    a_amg8833_decode_fixed_scalar,
+    a_amg8833_decode_real_scalar,
+};
+
+#if defined(AMG8833_DECODE_X86)
+
+/**
+ * @brief      sse2 sign extend
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[out] *out pointer to 64 pixels
+ * @param[in]  reverse reverse the pixel order
+ * @note       bit 11 is moved to bit 15 and shifted back arithmetically
+ */
+__attribute__((target("sse2")))
+static void a_amg8833_decode_extend_sse2(const uint8_t *buf, int16_t *out, uint8_t reverse)
+{
+    uint8_t i;
+    __m128i x;
+    
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = _mm_loadu_si128((const __m128i *)(buf + i * 16));                                       /* load 8 pixels */
+        x = _mm_srai_epi16(_mm_slli_epi16(x, 4), 4);                                                /* sign extend */
+        if (reverse != 0)                                                                           /* reverse */
+        {
+            x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));                                    /* reverse the low half */
+            x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));                                    /* reverse the high half */
+            x = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));                                      /* swap the halves */
+            _mm_storeu_si128((__m128i *)(out + (7 - i) * 8), x);                                    /* store 8 pixels */
+        }
+        else
+        {
+            _mm_storeu_si128((__m128i *)(out + i * 8), x);                                          /* store 8 pixels */
+        }
+    }
+}
+
+/**
+ * @brief      sse2 widen and scale
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 fixed point pixels
+ * @param[in]  scale scale
+ * @note       the 32 bits products are built from the low and high 16 bits products
+ */
+__attribute__((target("sse2")))
+static void a_amg8833_decode_fixed_sse2(const int16_t *in, int32_t *out, int16_t scale)
+{
+    uint8_t i;
+    __m128i s;
+    __m128i x;
+    __m128i lo;
+    __m128i hi;
+    
+    s = _mm_set1_epi16(scale);                                                                      /* set the scale */
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = _mm_loadu_si128((const __m128i *)(in + i * 8));                                         /* load 8 pixels */
+        lo = _mm_mullo_epi16(x, s);                                                                 /* low 16 bits */
+        hi = _mm_mulhi_epi16(x, s);                                                                 /* high 16 bits */
+        _mm_storeu_si128((__m128i *)(out + i * 8 + 0), _mm_unpacklo_epi16(lo, hi));                 /* store 4 pixels */
+        _mm_storeu_si128((__m128i *)(out + i * 8 + 4), _mm_unpackhi_epi16(lo, hi));                 /* store 4 pixels */
+    }
+}
+
+/**
+ * @brief      sse2 convert
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 float pixels
+ * @note       none
+ */
+__attribute__((target("sse2")))
+static void a_amg8833_decode_real_sse2(const int16_t *in, float *out)
+{
+    uint8_t i;
+    __m128 k;
+    __m128i x;
+    
+    k = _mm_set1_ps(0.25f);                                                                         /* set the lsb */
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = _mm_loadu_si128((const __m128i *)(in + i * 8));                                         /* load 8 pixels */
+        _mm_storeu_ps(out + i * 8 + 0,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), k));    /* store 4 pixels */
+        _mm_storeu_ps(out + i * 8 + 4,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), k));    /* store 4 pixels */
+    }
+}
+
+/**
+ * @brief sse2 path definition
+ */
+static const a_amg8833_decode_ops_t gs_decode_sse2 =
+{
+    a_amg8833_decode_extend_sse2,
+    a_amg8833_decode_fixed_sse2,
+    a_amg8833_decode_real_sse2,
+};
+
+/**
+ * @brief      avx2 sign extend
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[out] *out pointer to 64 pixels
+ * @param[in]  reverse reverse the pixel order
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_amg8833_decode_extend_avx2(const uint8_t *buf, int16_t *out, uint8_t reverse)
+{
+    uint8_t i;
+    __m256i x;
+    
+    for (i = 0; i < 4; i++)                                                                         /* 16 pixels every time */
+    {
+        x = _mm256_loadu_si256((const __m256i *)(buf + i * 32));                                    /* load 16 pixels */
+        x = _mm256_srai_epi16(_mm256_slli_epi16(x, 4), 4);                                          /* sign extend */
+        if (reverse != 0)                                                                           /* reverse */
+        {
+            x = _mm256_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));                                 /* reverse the low quarters */
+            x = _mm256_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));                                 /* reverse the high quarters */
+            x = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));                                   /* swap the quarters */
+            x = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 3, 2));                               /* swap the lanes */
+            _mm256_storeu_si256((__m256i *)(out + (3 - i) * 16), x);                                /* store 16 pixels */
+        }
+        else
+        {
+            _mm256_storeu_si256((__m256i *)(out + i * 16), x);                                      /* store 16 pixels */
+        }
+    }
+}
+
+/**
+ * @brief      avx2 widen and scale
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 fixed point pixels
+ * @param[in]  scale scale
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_amg8833_decode_fixed_avx2(const int16_t *in, int32_t *out, int16_t scale)
+{
+    uint8_t i;
+    __m256i s;
+    __m256i x;
+    
+    s = _mm256_set1_epi32(scale);                                                                   /* set the scale */
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in + i * 8)));                  /* load and widen 8 pixels */
+        _mm256_storeu_si256((__m256i *)(out + i * 8), _mm256_mullo_epi32(x, s));                    /* store 8 pixels */
+    }
+}
+
+/**
+ * @brief      avx2 convert
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 float pixels
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_amg8833_decode_real_avx2(const int16_t *in, float *out)
+{
+    uint8_t i;
+    __m256 k;
+    __m256i x;
+    
+    k = _mm256_set1_ps(0.25f);                                                                      /* set the lsb */
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in + i * 8)));                  /* load and widen 8 pixels */
+        _mm256_storeu_ps(out + i * 8, _mm256_mul_ps(_mm256_cvtepi32_ps(x), k));                     /* store 8 pixels */
+    }
+}
+
+/**
+ * @brief avx2 path definition
+ */
+static const a_amg8833_decode_ops_t gs_decode_avx2 =
+{
+    a_amg8833_decode_extend_avx2,
+    a_amg8833_decode_fixed_avx2,
+    a_amg8833_decode_real_avx2,
+};
+
+#endif
+
+#if defined(AMG8833_DECODE_NEON)
+
+/**
+ * @brief      neon sign extend
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[out] *out pointer to 64 pixels
+ * @param[in]  reverse reverse the pixel order
+ * @note       none
+ */
+static void a_amg8833_decode_extend_neon(const uint8_t *buf, int16_t *out, uint8_t reverse)
+{
+    uint8_t i;
+    int16x8_t x;
+    
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = vreinterpretq_s16_u8(vld1q_u8(buf + i * 16));                                           /* load 8 pixels */
+        x = vshrq_n_s16(vshlq_n_s16(x, 4), 4);                                                      /* sign extend */
+        if (reverse != 0)                                                                           /* reverse */
+        {
+            x = vrev64q_s16(x);                                                                     /* reverse the halves */
+            x = vcombine_s16(vget_high_s16(x), vget_low_s16(x));                                    /* swap the halves */
+            vst1q_s16(out + (7 - i) * 8, x);                                                        /* store 8 pixels */
+        }
+        else
+        {
+            vst1q_s16(out + i * 8, x);                                                              /* store 8 pixels */
+        }
+    }
+}
+
+/**
+ * @brief      neon widen and scale
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 fixed point pixels
+ * @param[in]  scale scale
+ * @note       none
+ */
+static void a_amg8833_decode_fixed_neon(const int16_t *in, int32_t *out, int16_t scale)
+{
+    uint8_t i;
+    int16x8_t x;
+    
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = vld1q_s16(in + i * 8);                                                                  /* load 8 pixels */
+        vst1q_s32(out + i * 8 + 0, vmull_n_s16(vget_low_s16(x), scale));                            /* store 4 pixels */
+        vst1q_s32(out + i * 8 + 4, vmull_n_s16(vget_high_s16(x), scale));                           /* store 4 pixels */
+    }
+}
+
+/**
+ * @brief      neon convert
+ * @param[in]  *in pointer to 64 pixels
+ * @param[out] *out pointer to 64 float pixels
+ * @note       none
+ */
+static void a_amg8833_decode_real_neon(const int16_t *in, float *out)
+{
+    uint8_t i;
+    int16x8_t x;
+    float32x4_t lo;
+    float32x4_t hi;
+    
+    for (i = 0; i < 8; i++)                                                                         /* 8 pixels every time */
+    {
+        x = vld1q_s16(in + i * 8);                                                                  /* load 8 pixels */
+        lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(x)));                                             /* convert the low half */
+        hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(x)));                                            /* convert the high half */
+        vst1q_f32(out + i * 8 + 0, vmulq_n_f32(lo, 0.25f));                                         /* store 4 pixels */
+        vst1q_f32(out + i * 8 + 4, vmulq_n_f32(hi, 0.25f));                                         /* store 4 pixels */
+    }
+}
+
+/**
+ * @brief neon path definition
+ */
+static const a_amg8833_decode_ops_t gs_decode_neon =
+{
+    a_amg8833_decode_extend_neon,
+    a_amg8833_decode_fixed_neon,
+    a_amg8833_decode_real_neon,
+};
+
+#endif
+
+/**
+ * @brief decode path state definition
+ */
+static amg8833_decode_path_t gs_decode_path = AMG8833_DECODE_PATH_AUTO;        /**< selected path */
+
+/**
+ * @brief     check whether a path is supported
+ * @param[in] path decode path
+ * @return    status code
+ *            - 0 not supported
+ *            - 1 supported
+ * @note      none
+ */
+static uint8_t a_amg8833_decode_supported(amg8833_decode_path_t path)
+{
+    if (path == AMG8833_DECODE_PATH_SCALAR)                                                         /* scalar */
+    {
+        return 1;                                                                                   /* always supported */
+    }
+#if defined(AMG8833_DECODE_X86)
+    if (path == AMG8833_DECODE_PATH_SSE2)                                                           /* sse2 */
+    {
+        return (__builtin_cpu_supports("sse2") != 0) ? 1 : 0;                                       /* check the cpu */
+    }
+    if (path == AMG8833_DECODE_PATH_AVX2)                                                           /* avx2 */
+    {
+        return (__builtin_cpu_supports("avx2") != 0) ? 1 : 0;                                       /* check the cpu */
+    }
+#endif
+#if defined(AMG8833_DECODE_NEON)
+    if (path == AMG8833_DECODE_PATH_NEON)                                                           /* neon */
+    {
+        return 1;                                                                                   /* neon build */
+    }
+#endif
+    
+    return 0;                                                                                       /* not supported */
+}
+
+/**
+ * @brief  resolve the decode path
+ * @return decode path in use
+ * @note   none
+ */
+static amg8833_decode_path_t a_amg8833_decode_resolve(void)
+{
+    if (gs_decode_path != AMG8833_DECODE_PATH_AUTO)                                                 /* selected by the user */
+    {
+        return gs_decode_path;                                                                      /* return the path */
+    }
+    if (a_amg8833_decode_supported(AMG8833_DECODE_PATH_AVX2) != 0)                                  /* avx2 first */
+    {
+        return AMG8833_DECODE_PATH_AVX2;                                                            /* avx2 */
+    }
+    if (a_amg8833_decode_supported(AMG8833_DECODE_PATH_NEON) != 0)                                  /* then neon */
+    {
+        return AMG8833_DECODE_PATH_NEON;                                                            /* neon */
+    }
+    if (a_amg8833_decode_supported(AMG8833_DECODE_PATH_SSE2) != 0)                                  /* then sse2 */
+    {
+        return AMG8833_DECODE_PATH_SSE2;                                                            /* sse2 */
+    }
+    
+    return AMG8833_DECODE_PATH_SCALAR;                                                              /* scalar */
+}
+
+/**
+ * @brief     set the decode path
+ * @param[in] path decode path
+ * @return    status code
+ *            - 0 success
+ *            - 1 path is not supported
+ * @note      none
+ */
+uint8_t amg8833_decode_set_path(amg8833_decode_path_t path)
+{
+    if ((path != AMG8833_DECODE_PATH_AUTO) && (a_amg8833_decode_supported(path) == 0))              /* check the path */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    gs_decode_path = path;                                                                          /* set the path */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the decode path
+ * @param[out] *path pointer to a decode path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 path is NULL
+ * @note       none
+ */
+uint8_t amg8833_decode_get_path(amg8833_decode_path_t *path)
+{
+    if (path == NULL)                                                                               /* check the path */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    
+    *path = a_amg8833_decode_resolve();                                                             /* get the path */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      decode many frame buffers at once
+ * @param[in]  *raw pointer to n frame buffers of AMG8833_FRAME_BUFFER_SIZE bytes
+ * @param[in]  n frame number
+ * @param[in]  orientation pixel orientation
+ * @param[in]  format output format
+ * @param[out] *out pointer to n [8][8] arrays of the output format type
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ *             - 4 orientation or format is invalid
+ * @note       none
+ */
+uint8_t amg8833_decode_frames(const uint8_t *raw, size_t n, amg8833_orientation_t orientation,
+                              amg8833_decode_format_t format, void *out)
+{
+    const a_amg8833_decode_ops_t *ops;
+    int16_t pixel[64];
+    int16_t oriented[64];
+    int16_t *dst;
+    int16_t scale;
+    int16_t index;
+    uint8_t i;
+    uint8_t j;
+    size_t k;
+    
+    if ((raw == NULL) || (out == NULL))                                                             /* check the buffers */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    if ((uint8_t)orientation > AMG8833_ORIENTATION_ANTI_TRANSPOSE)                                  /* check orientation */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    if (format == AMG8833_DECODE_FORMAT_FIXED_Q8)                                                   /* 1/256C */
+    {
+        scale = 64;                                                                                 /* x64 */
+    }
+    else if (format == AMG8833_DECODE_FORMAT_FIXED_CENTI)                                           /* 0.01C */
+    {
+        scale = 25;                                                                                 /* x25 */
+    }
+    else if ((format == AMG8833_DECODE_FORMAT_RAW) ||
+             (format == AMG8833_DECODE_FORMAT_FIXED_Q2) ||
+             (format == AMG8833_DECODE_FORMAT_FLOAT))                                               /* 0.25C */
+    {
+        scale = 1;                                                                                  /* x1 */
+    }
+    else
+    {
+        return 4;                                                                                   /* return error */
+    }
+    
+    switch (a_amg8833_decode_resolve())                                                             /* select the path */
+    {
+#if defined(AMG8833_DECODE_X86)
+        case AMG8833_DECODE_PATH_AVX2 :
+        {
+            ops = &gs_decode_avx2;                                                                  /* avx2 */
+            
+            break;
+        }
+        case AMG8833_DECODE_PATH_SSE2 :
+        {
+            ops = &gs_decode_sse2;                                                                  /* sse2 */
+            
+            break;
+        }
+#endif
+#if defined(AMG8833_DECODE_NEON)
+        case AMG8833_DECODE_PATH_NEON :
+        {
+            ops = &gs_decode_neon;                                                                  /* neon */
+            
+            break;
+        }
+#endif
+        default :
+        {
+            ops = &gs_decode_scalar;                                                                /* scalar */
+            
+            break;
+        }
+    }
+    
+    for (k = 0; k < n; k++)                                                                         /* decode all frames */
+    {
+        if (format == AMG8833_DECODE_FORMAT_RAW)                                                    /* raw output */
+        {
+            dst = (int16_t *)out + k * 64;                                                          /* decode in place */
+        }
+        else
+        {
+            dst = oriented;                                                                         /* decode to the local buffer */
+        }
+        if (orientation == AMG8833_ORIENTATION_IDENTITY)                                            /* identity is the reversed order */
+        {
+            ops->extend(raw + k * AMG8833_FRAME_BUFFER_SIZE, dst, 1);                               /* sign extend */
+        }
+        else if (orientation == AMG8833_ORIENTATION_ROTATE_180)                                     /* rotate 180 is the register order */
+        {
+            ops->extend(raw + k * AMG8833_FRAME_BUFFER_SIZE, dst, 0);                               /* sign extend */
+        }
+        else
+        {
+            ops->extend(raw + k * AMG8833_FRAME_BUFFER_SIZE, pixel, 0);                             /* sign extend */
+            for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+            {
+                index = g_amg8833_orientation_table[orientation][0] +
+                        i * g_amg8833_orientation_table[orientation][1];                            /* get the row start */
+                for (j = 0; j < 8; j++)                                                             /* run 8 times */
+                {
+                    dst[index] = pixel[i * 8 + j];                                                  /* set the pixel */
+                    index += g_amg8833_orientation_table[orientation][2];                           /* next column */
+                }
+            }
+        }
+        if (format == AMG8833_DECODE_FORMAT_FLOAT)                                                  /* float output */
+        {
+            ops->real(dst, (float *)out + k * 64);                                                  /* convert */
+        }
+        else if (format != AMG8833_DECODE_FORMAT_RAW)                                               /* fixed point output */
+        {
+            ops->fixed(dst, (int32_t *)out + k * 64, scale);                                        /* widen and scale */
+        }
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
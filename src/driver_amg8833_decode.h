@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_decode.h
+ * @brief     driver amg8833 decode header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_DECODE_H
+#define DRIVER_AMG8833_DECODE_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_decode_driver amg8833 decode driver function
+ * @brief    amg8833 decode driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 decode format enumeration definition
+ */
+typedef enum
+{
+    AMG8833_DECODE_FORMAT_RAW         = 0x00,        /**< int16_t, 0.25C per lsb */
+    AMG8833_DECODE_FORMAT_FIXED_Q2    = 0x01,        /**< int32_t, 0.25C per lsb */
+    AMG8833_DECODE_FORMAT_FIXED_Q8    = 0x02,        /**< int32_t, 1/256C per lsb */
+    AMG8833_DECODE_FORMAT_FIXED_CENTI = 0x03,        /**< int32_t, 0.01C per lsb */
+    AMG8833_DECODE_FORMAT_FLOAT       = 0x04,        /**< float, 1C per lsb */
+} amg8833_decode_format_t;
+
+/**
+ * @brief amg8833 decode path enumeration definition
+ */
+typedef enum
+{
+    AMG8833_DECODE_PATH_AUTO   = 0x00,        /**< best supported path */
+    AMG8833_DECODE_PATH_SCALAR = 0x01,        /**< portable c */
+    AMG8833_DECODE_PATH_SSE2   = 0x02,        /**< x86 sse2 */
+    AMG8833_DECODE_PATH_AVX2   = 0x03,        /**< x86 avx2 */
+    AMG8833_DECODE_PATH_NEON   = 0x04,        /**< arm neon */
+} amg8833_decode_path_t;
+
+/**
+ * @brief     set the decode path
+ * @param[in] path decode path
+ * @return    status code
+ *            - 0 success
+ *            - 1 path is not supported
+ * @note      the path is shared by all threads, the auto path is used by default,
+ *            x86 paths are checked at run time and the neon path needs a neon build
+ */
+uint8_t amg8833_decode_set_path(amg8833_decode_path_t path);
+
+/**
+ * @brief      get the decode path
+ * @param[out] *path pointer to a decode path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 path is NULL
+ * @note       the auto path is resolved to the path in use
+ */
+uint8_t amg8833_decode_get_path(amg8833_decode_path_t *path);
+
+/**
+ * @brief      decode many frame buffers at once
+ * @param[in]  *raw pointer to n frame buffers of AMG8833_FRAME_BUFFER_SIZE bytes
+ * @param[in]  n frame number
+ * @param[in]  orientation pixel orientation
+ * @param[in]  format output format
+ * @param[out] *out pointer to n [8][8] arrays of the output format type
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ *             - 4 orientation or format is invalid
+ * @note       the result of every frame is the same as amg8833_read_temperature_array
+ *             with the same orientation and all the paths give bit exact results
+ */
+uint8_t amg8833_decode_frames(const uint8_t *raw, size_t n, amg8833_orientation_t orientation,
+                              amg8833_decode_format_t format, void *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_filter.c
+ * @brief     driver amg8833 filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_filter.h"
+
+/**
+ * @brief     init the filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] mode filter mode
+ * @param[in] param filter parameter
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t amg8833_filter_init(amg8833_filter_t *filter, amg8833_filter_mode_t mode, uint8_t param)
+{
+    if (filter == NULL)                                                                             /* check filter */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    if (mode == AMG8833_FILTER_MODE_IIR)                                                            /* iir */
+    {
+        if ((param < 1) || (param > 7))                                                             /* check shift */
+        {
+            return 1;                                                                               /* return error */
+        }
+        filter->shift = param;                                                                      /* set shift */
+        filter->depth = 0;                                                                          /* no history */
+    }
+    else if (mode == AMG8833_FILTER_MODE_BOX)                                                       /* box */
+    {
+        if ((param < 1) || (param > AMG8833_FILTER_MAX_DEPTH))                                      /* check depth */
+        {
+            return 1;                                                                               /* return error */
+        }
+        filter->shift = 0;                                                                          /* no shift */
+        filter->depth = param;                                                                      /* set depth */
+    }
+    else if (mode == AMG8833_FILTER_MODE_MEDIAN3)                                                   /* median3 */
+    {
+        if (AMG8833_FILTER_MAX_DEPTH < 3)                                                           /* check history size */
+        {
+            return 1;                                                                               /* return error */
+        }
+        filter->shift = 0;                                                                          /* no shift */
+        filter->depth = 3;                                                                          /* 3 frames */
+    }
+    else
+    {
+        return 1;                                                                                   /* return error */
+    }
+    filter->mode = (uint8_t)mode;                                                                   /* set mode */
+    
+    return amg8833_filter_reset(filter);                                                            /* reset the history */
+}
+
+/**
+ * @brief     reset the filter history
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t amg8833_filter_reset(amg8833_filter_t *filter)
+{
+    uint8_t i;
+    
+    if (filter == NULL)                                                                             /* check filter */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    filter->count = 0;                                                                              /* clear count */
+    filter->index = 0;                                                                              /* clear index */
+    for (i = 0; i < 64; i++)                                                                        /* clear the state */
+    {
+        filter->state[i] = 0;                                                                       /* clear */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      filter a raw frame
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  **in pointer to a raw temperature frame
+ * @param[out] **out pointer to a filtered raw temperature frame
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ *             - 2 filter is NULL
+ * @note       none
+ */
+uint8_t amg8833_filter_update(amg8833_filter_t *filter, const int16_t in[8][8], int16_t out[8][8])
+{
+    uint8_t i;
+    uint8_t full;
+    int32_t x;
+    int32_t n;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t lo;
+    int32_t hi;
+    int32_t *state;
+    int16_t *history;
+    const int16_t *src;
+    int16_t *dst;
+    
+    if (filter == NULL)                                                                             /* check filter */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if ((in == NULL) || (out == NULL))                                                              /* check buffer */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    src = &in[0][0];                                                                                /* get the input */
+    dst = &out[0][0];                                                                               /* get the output */
+    state = filter->state;                                                                          /* get the state */
+    if (filter->mode == AMG8833_FILTER_MODE_IIR)                                                    /* iir */
+    {
+        if (filter->count == 0)                                                                     /* first frame */
+        {
+            for (i = 0; i < 64; i++)                                                                /* run 64 times */
+            {
+                x = src[i];                                                                         /* get the pixel */
+                state[i] = x * 256;                                                                 /* start from the input */
+                dst[i] = (int16_t)x;                                                                /* set the output */
+            }
+            filter->count = 1;                                                                      /* started */
+        }
+        else
+        {
+            for (i = 0; i < 64; i++)                                                                /* run 64 times */
+            {
+                x = src[i] * 256;                                                                   /* get the pixel in 1/256 lsb */
+                state[i] += (x - state[i]) >> filter->shift;                                        /* move to the input */
+                dst[i] = (int16_t)((state[i] + 128) >> 8);                                          /* round to lsb */
+            }
+        }
+    }
+    else if (filter->mode == AMG8833_FILTER_MODE_BOX)                                               /* box */
+    {
+        history = filter->history[filter->index];                                                   /* get the oldest frame */
+        full = (uint8_t)(filter->count == filter->depth);                                           /* check full */
+        n = (full != 0) ? filter->count : (filter->count + 1);                                      /* get the frame number */
+        for (i = 0; i < 64; i++)                                                                    /* run 64 times */
+        {
+            x = src[i];                                                                             /* get the pixel */
+            state[i] += x - ((full != 0) ? history[i] : 0);                                         /* update the sum */
+            history[i] = (int16_t)x;                                                                /* save the pixel */
+            x = state[i];                                                                           /* get the sum */
+            dst[i] = (int16_t)(((x < 0) ? (x - n / 2) : (x + n / 2)) / n);                          /* round to the nearest */
+        }
+        filter->count = (uint8_t)n;                                                                 /* set the count */
+        filter->index = (uint8_t)((filter->index + 1) % filter->depth);                             /* next index */
+    }
+    else if (filter->mode == AMG8833_FILTER_MODE_MEDIAN3)                                           /* median3 */
+    {
+        history = filter->history[filter->index];                                                   /* get the oldest frame */
+        for (i = 0; i < 64; i++)                                                                    /* run 64 times */
+        {
+            history[i] = src[i];                                                                    /* save the pixel */
+        }
+        if (filter->count < 3)                                                                      /* check the history */
+        {
+            filter->count++;                                                                        /* count the frame */
+        }
+        if (filter->count < 3)                                                                      /* not filled */
+        {
+            for (i = 0; i < 64; i++)                                                                /* run 64 times */
+            {
+                dst[i] = history[i];                                                                /* pass the input */
+            }
+        }
+        else
+        {
+            for (i = 0; i < 64; i++)                                                                /* run 64 times */
+            {
+                a = filter->history[0][i];                                                          /* get the frame 0 */
+                b = filter->history[1][i];                                                          /* get the frame 1 */
+                c = filter->history[2][i];                                                          /* get the frame 2 */
+                lo = (a < b) ? a : b;                                                               /* min of a and b */
+                hi = (a < b) ? b : a;                                                               /* max of a and b */
+                hi = (hi < c) ? hi : c;                                                             /* min of max and c */
+                dst[i] = (int16_t)((lo < hi) ? hi : lo);                                            /* max of both */
+            }
+        }
+        filter->index = (uint8_t)((filter->index + 1) % 3);                                         /* next index */
+    }
+    else
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
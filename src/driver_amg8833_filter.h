@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_filter.h
+ * @brief     driver amg8833 filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_FILTER_H
+#define DRIVER_AMG8833_FILTER_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_filter_driver amg8833 filter driver function
+ * @brief    amg8833 filter driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 filter max box depth definition
+ */
+#ifndef AMG8833_FILTER_MAX_DEPTH
+    #define AMG8833_FILTER_MAX_DEPTH 8        /**< 8 frames */
+#endif
+
+/**
+ * @brief amg8833 filter mode enumeration definition
+ */
+typedef enum
+{
+    AMG8833_FILTER_MODE_IIR     = 0x00,        /**< per pixel exponential smoothing */
+    AMG8833_FILTER_MODE_BOX     = 0x01,        /**< n frames box average */
+    AMG8833_FILTER_MODE_MEDIAN3 = 0x02,        /**< median of the last 3 frames */
+} amg8833_filter_mode_t;
+
+/**
+ * @brief amg8833 filter structure definition
+ */
+typedef struct amg8833_filter_s
+{
+    uint8_t mode;                                             /**< filter mode */
+    uint8_t shift;                                            /**< iir smoothing shift */
+    uint8_t depth;                                            /**< history depth */
+    uint8_t count;                                            /**< filled history number */
+    uint8_t index;                                            /**< next history index */
+    int32_t state[64];                                        /**< iir state in 1/256 lsb or box sum */
+    int16_t history[AMG8833_FILTER_MAX_DEPTH][64];            /**< history frames */
+} amg8833_filter_t;
+
+/**
+ * @brief     init the filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] mode filter mode
+ * @param[in] param filter parameter
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 filter is NULL
+ * @note      iir: param is the smoothing shift 1 - 7, every frame moves 1 / 2^param of the way to the input
+ *            box: param is the frame number 1 - AMG8833_FILTER_MAX_DEPTH
+ *            median3: param is ignored
+ */
+uint8_t amg8833_filter_init(amg8833_filter_t *filter, amg8833_filter_mode_t mode, uint8_t param);
+
+/**
+ * @brief     reset the filter history
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      the next frame restarts the filter
+ */
+uint8_t amg8833_filter_reset(amg8833_filter_t *filter);
+
+/**
+ * @brief      filter a raw frame
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  **in pointer to a raw temperature frame
+ * @param[out] **out pointer to a filtered raw temperature frame
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ *             - 2 filter is NULL
+ * @note       in and out can be the same buffer, the input is the raw output of amg8833_read_temperature_array,
+ *             until the history is filled the box average uses the frames so far and the median passes the input
+ */
+uint8_t amg8833_filter_update(amg8833_filter_t *filter, const int16_t in[8][8], int16_t out[8][8]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,779 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_record.c
+ * @brief     driver amg8833 record source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_record.h"
+
+/**
+ * @brief record tag definition
+ */
+#define AMG8833_RECORD_TAG_KEY          0xA0        /**< key frame record */
+#define AMG8833_RECORD_TAG_DELTA        0xA1        /**< delta frame record */
+#define AMG8833_RECORD_TAG_XOR          0xA2        /**< xor frame record */
+#define AMG8833_RECORD_KEY_SIZE         96          /**< packed 12 bits payload size */
+#define AMG8833_RECORD_CODE_SIZE        128         /**< worst nibble code size, 4 nibbles every pixel */
+
+/**
+ * @brief record magic definition
+ */
+static const uint8_t gs_record_file_magic[4] = {'A', 'M', 'G', 'R'};         /**< file magic */
+static const uint8_t gs_record_block_magic[4] = {'B', 'L', 'K', '0'};        /**< block magic */
+
+/**
+ * @brief     crc16 ccitt
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc
+ * @note      poly 0x1021, init 0xFFFF
+ */
+static uint16_t a_amg8833_record_crc16(const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t j;
+    uint16_t crc;
+    
+    crc = 0xFFFF;                                                                                           /* init crc */
+    for (i = 0; i < len; i++)                                                                               /* run len times */
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);                                                          /* xor the byte */
+        for (j = 0; j < 8; j++)                                                                             /* run 8 times */
+        {
+            crc = (uint16_t)(((crc & 0x8000) != 0) ? ((crc << 1) ^ 0x1021) : (crc << 1));                   /* shift the poly */
+        }
+    }
+    
+    return crc;                                                                                             /* return crc */
+}
+
+/**
+ * @brief     put a little endian value
+ * @param[in] *p pointer to a buffer
+ * @param[in] v value
+ * @param[in] len byte number
+ * @note      none
+ */
+static void a_amg8833_record_put(uint8_t *p, uint64_t v, uint8_t len)
+{
+    uint8_t i;
+    
+    for (i = 0; i < len; i++)                                                                               /* run len times */
+    {
+        p[i] = (uint8_t)(v >> (8 * i));                                                                     /* set the byte */
+    }
+}
+
+/**
+ * @brief     get a little endian value
+ * @param[in] *p pointer to a buffer
+ * @param[in] len byte number
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_amg8833_record_get(const uint8_t *p, uint8_t len)
+{
+    uint8_t i;
+    uint64_t v;
+    
+    v = 0;                                                                                                  /* init value */
+    for (i = 0; i < len; i++)                                                                               /* run len times */
+    {
+        v |= (uint64_t)p[i] << (8 * i);                                                                     /* get the byte */
+    }
+    
+    return v;                                                                                               /* return value */
+}
+
+/**
+ * @brief     check a block header
+ * @param[in] *data pointer to the file data
+ * @param[in] len file data length
+ * @param[in] offset block header offset
+ * @return    status code
+ *            - 0 not a block header
+ *            - 1 valid block header
+ * @note      none
+ */
+static uint8_t a_amg8833_record_is_block(const uint8_t *data, uint32_t len, uint32_t offset)
+{
+    if ((len < AMG8833_RECORD_BLOCK_HEADER_SIZE) || (offset > len - AMG8833_RECORD_BLOCK_HEADER_SIZE))      /* check length */
+    {
+        return 0;                                                                                           /* not a block */
+    }
+    if (memcmp(&data[offset], gs_record_block_magic, 4) != 0)                                               /* check magic */
+    {
+        return 0;                                                                                           /* not a block */
+    }
+    if (a_amg8833_record_crc16(&data[offset], AMG8833_RECORD_BLOCK_HEADER_SIZE - 2) != 
+        (uint16_t)a_amg8833_record_get(&data[offset + AMG8833_RECORD_BLOCK_HEADER_SIZE - 2], 2))            /* check crc */
+    {
+        return 0;                                                                                           /* not a block */
+    }
+    
+    return 1;                                                                                               /* valid block */
+}
+
+/**
+ * @brief      find the next block header
+ * @param[in]  *data pointer to the file data
+ * @param[in]  len file data length
+ * @param[in]  offset search start offset
+ * @param[out] *pos pointer to a block header offset buffer
+ * @return     status code
+ *             - 0 not found
+ *             - 1 found
+ * @note       none
+ */
+static uint8_t a_amg8833_record_find_block(const uint8_t *data, uint32_t len, uint32_t offset, uint32_t *pos)
+{
+    while ((len >= AMG8833_RECORD_BLOCK_HEADER_SIZE) && (offset <= len - AMG8833_RECORD_BLOCK_HEADER_SIZE))    /* search the data */
+    {
+        if ((data[offset] == gs_record_block_magic[0]) && (a_amg8833_record_is_block(data, len, offset) != 0))    /* check block */
+        {
+            *pos = offset;                                                                                  /* set the position */
+            
+            return 1;                                                                                       /* found */
+        }
+        offset++;                                                                                           /* next byte */
+    }
+    
+    return 0;                                                                                               /* not found */
+}
+
+/**
+ * @brief     check a frame record
+ * @param[in] *data pointer to the file data
+ * @param[in] len file data length
+ * @param[in] offset frame record offset
+ * @return    status code
+ *            - 0 valid frame record
+ *            - 1 corrupt record
+ *            - 2 record is cut at the end of the data
+ * @note      none
+ */
+static uint8_t a_amg8833_record_check_frame(const uint8_t *data, uint32_t len, uint32_t offset)
+{
+    const uint8_t *rec;
+    
+    rec = &data[offset];                                                                                    /* get the record */
+    if ((rec[0] < AMG8833_RECORD_TAG_KEY) || (rec[0] > AMG8833_RECORD_TAG_XOR))                             /* check tag */
+    {
+        return 1;                                                                                           /* not a record */
+    }
+    if ((len - offset) < (AMG8833_RECORD_FRAME_HEADER_SIZE + 2))                                            /* check header length */
+    {
+        return 2;                                                                                           /* cut record */
+    }
+    if ((rec[2] > AMG8833_RECORD_MAX_PAYLOAD) || (rec[1] >= AMG8833_RECORD_MAX_SENSOR))                     /* check length and sensor */
+    {
+        return 1;                                                                                           /* not a record */
+    }
+    if ((len - offset) < (uint32_t)(AMG8833_RECORD_FRAME_HEADER_SIZE + rec[2] + 2))                         /* check length */
+    {
+        return 2;                                                                                           /* cut record */
+    }
+    if (a_amg8833_record_crc16(rec, AMG8833_RECORD_FRAME_HEADER_SIZE + rec[2]) != 
+        (uint16_t)a_amg8833_record_get(&rec[AMG8833_RECORD_FRAME_HEADER_SIZE + rec[2]], 2))                 /* check crc */
+    {
+        return 1;                                                                                           /* corrupt record */
+    }
+    
+    return 0;                                                                                               /* valid record */
+}
+
+/**
+ * @brief         put a nibble
+ * @param[out]    *out pointer to a payload buffer
+ * @param[in,out] *count pointer to a nibble number
+ * @param[in]     n nibble
+ * @note          the high nibble comes first
+ */
+static void a_amg8833_record_put_nibble(uint8_t *out, uint16_t *count, uint8_t n)
+{
+    if ((*count & 1) == 0)                                                                                  /* high nibble */
+    {
+        out[*count / 2] = (uint8_t)(n << 4);                                                                /* set the high nibble */
+    }
+    else
+    {
+        out[*count / 2] |= (uint8_t)(n & 0xF);                                                              /* set the low nibble */
+    }
+    (*count)++;                                                                                             /* next nibble */
+}
+
+/**
+ * @brief         put a 12 bits code
+ * @param[out]    *out pointer to a payload buffer
+ * @param[in,out] *count pointer to a nibble number
+ * @param[in]     v 12 bits value
+ * @note          values under 15 take one nibble, others take the escape nibble and 3 nibbles
+ */
+static void a_amg8833_record_put_code(uint8_t *out, uint16_t *count, uint16_t v)
+{
+    if (v < 15)                                                                                             /* short code */
+    {
+        a_amg8833_record_put_nibble(out, count, (uint8_t)v);                                                /* put the value */
+    }
+    else
+    {
+        a_amg8833_record_put_nibble(out, count, 15);                                                        /* put the escape */
+        a_amg8833_record_put_nibble(out, count, (uint8_t)((v >> 8) & 0xF));                                 /* put the high nibble */
+        a_amg8833_record_put_nibble(out, count, (uint8_t)((v >> 4) & 0xF));                                 /* put the middle nibble */
+        a_amg8833_record_put_nibble(out, count, (uint8_t)(v & 0xF));                                        /* put the low nibble */
+    }
+}
+
+/**
+ * @brief         get a 12 bits code
+ * @param[in]     *in pointer to a payload buffer
+ * @param[in]     len payload length
+ * @param[in,out] *count pointer to a nibble number
+ * @param[out]    *v pointer to a value buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 payload is too short
+ * @note          none
+ */
+static uint8_t a_amg8833_record_get_code(const uint8_t *in, uint8_t len, uint16_t *count, uint16_t *v)
+{
+    uint8_t i;
+    uint8_t n;
+    uint8_t num;
+    uint16_t value;
+    
+    num = 1;                                                                                                /* one nibble */
+    value = 0;                                                                                              /* init value */
+    for (i = 0; i < num; i++)                                                                               /* run num times */
+    {
+        if (*count >= (uint16_t)len * 2)                                                                    /* check length */
+        {
+            return 1;                                                                                       /* return error */
+        }
+        n = (uint8_t)((((*count & 1) == 0) ? (in[*count / 2] >> 4) : in[*count / 2]) & 0xF);                /* get the nibble */
+        (*count)++;                                                                                         /* next nibble */
+        if ((i == 0) && (n == 15))                                                                          /* escape */
+        {
+            num = 4;                                                                                        /* 3 more nibbles */
+        }
+        else
+        {
+            value = (uint16_t)((value << 4) | n);                                                           /* add the nibble */
+        }
+    }
+    *v = value;                                                                                             /* set the value */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     init the record writer
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] encoding frame encoding
+ * @param[in] block_frames records per block
+ * @param[in] *write pointer to an append function
+ * @param[in] *user pointer to an append function context
+ * @param[in] offset current file size
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 writer is NULL
+ * @note      when offset is 0 the file header is written, else the records are appended after offset,
+ *            to resume after a power loss truncate the file to the end given by amg8833_record_reader_get_end
+ */
+uint8_t amg8833_record_writer_init(amg8833_record_writer_t *writer, amg8833_record_encoding_t encoding, uint16_t block_frames,
+                                   uint8_t (*write)(void *user, const uint8_t *data, uint32_t len), void *user, uint32_t offset)
+{
+    uint8_t header[AMG8833_RECORD_FILE_HEADER_SIZE];
+    
+    if (writer == NULL)                                                                                     /* check writer */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if ((write == NULL) || (encoding > AMG8833_RECORD_ENCODING_XOR) || (block_frames == 0))                 /* check param */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    writer->write = write;                                                                                  /* set write */
+    writer->user = user;                                                                                    /* set user */
+    writer->block_timestamp = 0;                                                                            /* init block timestamp */
+    writer->offset = offset;                                                                                /* set offset */
+    writer->block = 0;                                                                                      /* init block */
+    writer->key = 0;                                                                                        /* no key frame */
+    writer->block_frames = block_frames;                                                                    /* set block frames */
+    writer->frames = 0;                                                                                     /* start a block with the next frame */
+    writer->encoding = (uint8_t)encoding;                                                                   /* set encoding */
+    if (offset == 0)                                                                                        /* new file */
+    {
+        memcpy(&header[0], gs_record_file_magic, 4);                                                        /* set magic */
+        a_amg8833_record_put(&header[4], AMG8833_RECORD_VERSION, 2);                                        /* set version */
+        a_amg8833_record_put(&header[6], encoding, 2);                                                      /* set encoding */
+        a_amg8833_record_put(&header[8], block_frames, 2);                                                  /* set block frames */
+        a_amg8833_record_put(&header[10], 0, 4);                                                            /* set reserved */
+        a_amg8833_record_put(&header[14], a_amg8833_record_crc16(header, 14), 2);                           /* set crc */
+        if (writer->write(writer->user, header, AMG8833_RECORD_FILE_HEADER_SIZE) != 0)                      /* write the header */
+        {
+            return 1;                                                                                       /* return error */
+        }
+        writer->offset = AMG8833_RECORD_FILE_HEADER_SIZE;                                                   /* set offset */
+    }
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     append a frame
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *frame pointer to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ *            - 4 sensor is invalid
+ *            - 5 file is full
+ * @note      every record is written with one append call, a record cut by a power loss is dropped by the reader,
+ *            the write fails with 5 and nothing is appended when a block header and a key frame may not fit
+ *            under AMG8833_RECORD_MAX_FILE_SIZE, then the recording goes on with a writer on a new file
+ */
+uint8_t amg8833_record_writer_write(amg8833_record_writer_t *writer, const amg8833_record_frame_t *frame)
+{
+    uint8_t i;
+    uint8_t tag;
+    uint16_t count;
+    uint16_t len;
+    uint16_t p;
+    uint16_t q;
+    uint16_t d;
+    uint16_t pix[64];
+    uint16_t *prev;
+    uint8_t rec[AMG8833_RECORD_FRAME_HEADER_SIZE + AMG8833_RECORD_CODE_SIZE + 2];
+    
+    if (writer == NULL)                                                                                     /* check writer */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if (frame == NULL)                                                                                      /* check frame */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    if (frame->sensor >= AMG8833_RECORD_MAX_SENSOR)                                                         /* check sensor */
+    {
+        return 4;                                                                                           /* return error */
+    }
+    if (writer->offset > AMG8833_RECORD_MAX_FILE_SIZE - (AMG8833_RECORD_BLOCK_HEADER_SIZE + 
+        AMG8833_RECORD_FRAME_HEADER_SIZE + AMG8833_RECORD_MAX_PAYLOAD + 2))                                 /* check file size */
+    {
+        return 5;                                                                                           /* return error */
+    }
+    
+    if ((writer->frames == 0) || (writer->frames >= writer->block_frames) || 
+        (frame->timestamp < writer->block_timestamp) || 
+        ((frame->timestamp - writer->block_timestamp) > 0xFFFFFFFFULL))                                     /* check new block */
+    {
+        memcpy(&rec[0], gs_record_block_magic, 4);                                                          /* set magic */
+        a_amg8833_record_put(&rec[4], writer->block, 4);                                                    /* set block */
+        a_amg8833_record_put(&rec[8], frame->timestamp, 8);                                                 /* set timestamp */
+        a_amg8833_record_put(&rec[16], 0, 2);                                                               /* set reserved */
+        a_amg8833_record_put(&rec[18], a_amg8833_record_crc16(rec, 18), 2);                                 /* set crc */
+        if (writer->write(writer->user, rec, AMG8833_RECORD_BLOCK_HEADER_SIZE) != 0)                        /* write the block header */
+        {
+            writer->frames = 0;                                                                             /* retry the block */
+            
+            return 1;                                                                                       /* return error */
+        }
+        writer->offset += AMG8833_RECORD_BLOCK_HEADER_SIZE;                                                 /* add offset */
+        writer->block++;                                                                                    /* next block */
+        writer->block_timestamp = frame->timestamp;                                                         /* set block timestamp */
+        writer->key = 0;                                                                                    /* no key frame */
+        writer->frames = 0;                                                                                 /* no frame */
+    }
+    
+    for (i = 0; i < 64; i++)                                                                                /* run 64 times */
+    {
+        pix[i] = (uint16_t)((((uint16_t)frame->buf[i * 2 + 1] & 0xF) << 8) | frame->buf[i * 2 + 0]);        /* get 12 bits */
+    }
+    prev = writer->prev[frame->sensor];                                                                     /* get the previous frame */
+    tag = AMG8833_RECORD_TAG_KEY;                                                                           /* key frame by default */
+    if ((writer->encoding != AMG8833_RECORD_ENCODING_RAW) && 
+        ((writer->key & (1UL << frame->sensor)) != 0))                                                      /* difference frame */
+    {
+        count = 0;                                                                                          /* no nibble */
+        for (i = 0; i < 64; i++)                                                                            /* run 64 times */
+        {
+            if (writer->encoding == AMG8833_RECORD_ENCODING_DELTA)                                          /* delta */
+            {
+                d = (uint16_t)((pix[i] - prev[i]) & 0xFFF);                                                 /* 12 bits difference */
+                d = (uint16_t)(((d & 0x800) != 0) ? (((0xFFF - d) << 1) | 1) : (d << 1));                   /* zigzag */
+            }
+            else
+            {
+                d = (uint16_t)(pix[i] ^ prev[i]);                                                           /* xor */
+            }
+            a_amg8833_record_put_code(&rec[AMG8833_RECORD_FRAME_HEADER_SIZE], &count, d);                   /* put the code */
+        }
+        len = (uint16_t)((count + 1) / 2);                                                                  /* set length */
+        if (len < AMG8833_RECORD_KEY_SIZE)                                                                  /* smaller than a key frame */
+        {
+            tag = (writer->encoding == AMG8833_RECORD_ENCODING_DELTA) ? AMG8833_RECORD_TAG_DELTA : AMG8833_RECORD_TAG_XOR;    /* set tag */
+        }
+    }
+    if (tag == AMG8833_RECORD_TAG_KEY)                                                                      /* key frame */
+    {
+        for (i = 0; i < 32; i++)                                                                            /* 2 pixels every time */
+        {
+            p = pix[i * 2 + 0];                                                                             /* get pixel 0 */
+            q = pix[i * 2 + 1];                                                                             /* get pixel 1 */
+            rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 0] = (uint8_t)(p & 0xFF);                        /* low byte of pixel 0 */
+            rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 1] = (uint8_t)((p >> 8) | ((q & 0xF) << 4));     /* high nibble and low nibble */
+            rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 2] = (uint8_t)(q >> 4);                          /* high byte of pixel 1 */
+        }
+        len = AMG8833_RECORD_KEY_SIZE;                                                                      /* set length */
+    }
+    rec[0] = tag;                                                                                           /* set tag */
+    rec[1] = frame->sensor;                                                                                 /* set sensor */
+    rec[2] = (uint8_t)len;                                                                                  /* set length */
+    rec[3] = frame->status;                                                                                 /* set status */
+    a_amg8833_record_put(&rec[4], (uint16_t)frame->thermistor, 2);                                          /* set thermistor */
+    a_amg8833_record_put(&rec[6], frame->timestamp - writer->block_timestamp, 4);                           /* set time */
+    a_amg8833_record_put(&rec[AMG8833_RECORD_FRAME_HEADER_SIZE + len], 
+                         a_amg8833_record_crc16(rec, AMG8833_RECORD_FRAME_HEADER_SIZE + len), 2);           /* set crc */
+    if (writer->write(writer->user, rec, AMG8833_RECORD_FRAME_HEADER_SIZE + len + 2) != 0)                  /* write the record */
+    {
+        writer->frames = 0;                                                                                 /* restart with a new block */
+        
+        return 1;                                                                                           /* return error */
+    }
+    writer->offset += AMG8833_RECORD_FRAME_HEADER_SIZE + len + 2;                                           /* add offset */
+    memcpy(prev, pix, sizeof(uint16_t) * 64);                                                               /* save the frame */
+    writer->key |= 1UL << frame->sensor;                                                                    /* sensor has a key frame */
+    writer->frames++;                                                                                       /* count the frame */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     init the record reader
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] *data pointer to the file data
+ * @param[in] len file data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 file header is invalid
+ *            - 2 reader is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_reader_init(amg8833_record_reader_t *reader, const uint8_t *data, uint32_t len)
+{
+    if (reader == NULL)                                                                                     /* check reader */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if ((data == NULL) || (len < AMG8833_RECORD_FILE_HEADER_SIZE))                                          /* check data */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    if (memcmp(data, gs_record_file_magic, 4) != 0)                                                         /* check magic */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    if (a_amg8833_record_crc16(data, 14) != (uint16_t)a_amg8833_record_get(&data[14], 2))                   /* check crc */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    if (a_amg8833_record_get(&data[4], 2) != AMG8833_RECORD_VERSION)                                        /* check version */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    reader->data = data;                                                                                    /* set data */
+    reader->len = len;                                                                                      /* set len */
+    reader->offset = AMG8833_RECORD_FILE_HEADER_SIZE;                                                       /* first block */
+    reader->end = AMG8833_RECORD_FILE_HEADER_SIZE;                                                          /* end of the header */
+    reader->corrupt = 0;                                                                                    /* no corrupt record */
+    reader->block_timestamp = 0;                                                                            /* no block */
+    reader->valid = 0;                                                                                      /* no previous frame */
+    reader->in_block = 0;                                                                                   /* not in a block */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      read the next frame
+ * @param[in]  *reader pointer to a reader structure
+ * @param[out] *frame pointer to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more frame
+ *             - 2 reader is NULL
+ * @note       a corrupt record is counted and the reader moves on to the next block,
+ *             a record cut at the end of the data ends the reading
+ */
+uint8_t amg8833_record_reader_read(amg8833_record_reader_t *reader, amg8833_record_frame_t *frame)
+{
+    uint8_t i;
+    uint8_t tag;
+    uint8_t len;
+    uint8_t sensor;
+    uint8_t bad;
+    uint16_t count;
+    uint16_t d;
+    uint16_t *prev;
+    uint32_t size;
+    uint32_t pos;
+    const uint8_t *rec;
+    
+    if (reader == NULL)                                                                                     /* check reader */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if (frame == NULL)                                                                                      /* check frame */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    while (reader->offset < reader->len)                                                                    /* until the end */
+    {
+        if (a_amg8833_record_is_block(reader->data, reader->len, reader->offset) != 0)                      /* block header */
+        {
+            rec = &reader->data[reader->offset];                                                            /* get the header */
+            reader->block_timestamp = a_amg8833_record_get(&rec[8], 8);                                     /* set block timestamp */
+            reader->valid = 0;                                                                              /* no previous frame */
+            reader->in_block = 1;                                                                           /* in a block */
+            reader->offset += AMG8833_RECORD_BLOCK_HEADER_SIZE;                                             /* skip the header */
+            reader->end = reader->offset;                                                                   /* set the end */
+            
+            continue;                                                                                       /* next record */
+        }
+        
+        rec = &reader->data[reader->offset];                                                                /* get the record */
+        tag = rec[0];                                                                                       /* get the tag */
+        if (reader->in_block == 0)                                                                          /* check block */
+        {
+            bad = 1;                                                                                        /* not a record */
+        }
+        else
+        {
+            bad = a_amg8833_record_check_frame(reader->data, reader->len, reader->offset);                  /* check the record */
+        }
+        if (bad == 0)                                                                                       /* valid record */
+        {
+            sensor = rec[1];                                                                                /* get the sensor */
+            len = rec[2];                                                                                   /* get the length */
+            prev = reader->prev[sensor];                                                                    /* get the previous frame */
+            if (tag == AMG8833_RECORD_TAG_KEY)                                                              /* key frame */
+            {
+                if (len != AMG8833_RECORD_KEY_SIZE)                                                         /* check length */
+                {
+                    bad = 1;                                                                                /* corrupt record */
+                }
+                for (i = 0; (i < 32) && (bad == 0); i++)                                                    /* 2 pixels every time */
+                {
+                    prev[i * 2 + 0] = (uint16_t)(rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 0] | 
+                                                 ((rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 1] & 0xF) << 8));    /* get pixel 0 */
+                    prev[i * 2 + 1] = (uint16_t)((rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 1] >> 4) | 
+                                                 (rec[AMG8833_RECORD_FRAME_HEADER_SIZE + i * 3 + 2] << 4));    /* get pixel 1 */
+                }
+            }
+            else if ((reader->valid & (1UL << sensor)) == 0)                                                /* no previous frame */
+            {
+                bad = 1;                                                                                    /* corrupt record */
+            }
+            else
+            {
+                count = 0;                                                                                  /* no nibble */
+                for (i = 0; (i < 64) && (bad == 0); i++)                                                    /* run 64 times */
+                {
+                    if (a_amg8833_record_get_code(&rec[AMG8833_RECORD_FRAME_HEADER_SIZE], len, &count, &d) != 0)    /* get the code */
+                    {
+                        bad = 1;                                                                            /* corrupt record */
+                    }
+                    else if (tag == AMG8833_RECORD_TAG_DELTA)                                               /* delta */
+                    {
+                        d = (uint16_t)(((d & 1) != 0) ? (0xFFF - (d >> 1)) : (d >> 1));                     /* undo the zigzag */
+                        prev[i] = (uint16_t)((prev[i] + d) & 0xFFF);                                        /* add the difference */
+                    }
+                    else
+                    {
+                        prev[i] = (uint16_t)((prev[i] ^ d) & 0xFFF);                                        /* undo the xor */
+                    }
+                }
+            }
+        }
+        
+        if (bad == 0)                                                                                       /* good record */
+        {
+            size = AMG8833_RECORD_FRAME_HEADER_SIZE + len + 2;                                              /* get the record size */
+            frame->sensor = sensor;                                                                         /* set sensor */
+            frame->status = rec[3];                                                                         /* set status */
+            frame->thermistor = (int16_t)a_amg8833_record_get(&rec[4], 2);                                  /* set thermistor */
+            frame->timestamp = reader->block_timestamp + a_amg8833_record_get(&rec[6], 4);                  /* set timestamp */
+            for (i = 0; i < 64; i++)                                                                        /* run 64 times */
+            {
+                frame->buf[i * 2 + 0] = (uint8_t)(prev[i] & 0xFF);                                          /* set the low byte */
+                frame->buf[i * 2 + 1] = (uint8_t)(prev[i] >> 8);                                            /* set the high byte */
+            }
+            reader->valid |= 1UL << sensor;                                                                 /* sensor has a previous frame */
+            reader->offset += size;                                                                         /* next record */
+            reader->end = reader->offset;                                                                   /* set the end */
+            
+            return 0;                                                                                       /* success return 0 */
+        }
+        
+        if (a_amg8833_record_find_block(reader->data, reader->len, reader->offset + 1, &pos) == 0)          /* find the next block */
+        {
+            if (bad == 1)                                                                                   /* corrupt tail */
+            {
+                reader->corrupt++;                                                                          /* count the corrupt record */
+            }
+            reader->offset = reader->len;                                                                   /* stop reading */
+            
+            return 1;                                                                                       /* no more frame */
+        }
+        reader->corrupt++;                                                                                  /* count the corrupt record */
+        reader->in_block = 0;                                                                               /* leave the block */
+        reader->offset = pos;                                                                               /* go to the next block */
+    }
+    
+    return 1;                                                                                               /* no more frame */
+}
+
+/**
+ * @brief         build the block index
+ * @param[in]     *reader pointer to a reader structure
+ * @param[out]    *index pointer to an index array
+ * @param[in,out] *num pointer to an index number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ *                - 2 reader is NULL
+ * @note          num is the array size as input and the block number as output,
+ *                the records are checked like amg8833_record_reader_read without decoding,
+ *                a corrupt record is skipped to the next block and the read position is kept
+ */
+uint8_t amg8833_record_reader_index(amg8833_record_reader_t *reader, amg8833_record_index_t *index, uint32_t *num)
+{
+    uint32_t n;
+    uint32_t pos;
+    const uint8_t *rec;
+    
+    if (reader == NULL)                                                                                     /* check reader */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if ((index == NULL) || (num == NULL))                                                                   /* check buffer */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    n = 0;                                                                                                  /* no block */
+    pos = AMG8833_RECORD_FILE_HEADER_SIZE;                                                                  /* first block */
+    while ((pos < reader->len) && (n < *num))                                                               /* until the end */
+    {
+        rec = &reader->data[pos];                                                                           /* get the record */
+        if (a_amg8833_record_is_block(reader->data, reader->len, pos) != 0)                                 /* block header */
+        {
+            index[n].offset = pos;                                                                          /* set offset */
+            index[n].block = (uint32_t)a_amg8833_record_get(&rec[4], 4);                                    /* set block */
+            index[n].timestamp = a_amg8833_record_get(&rec[8], 8);                                          /* set timestamp */
+            n++;                                                                                            /* next index */
+            pos += AMG8833_RECORD_BLOCK_HEADER_SIZE;                                                        /* skip the header */
+        }
+        else if (a_amg8833_record_check_frame(reader->data, reader->len, pos) == 0)                         /* valid record */
+        {
+            pos += AMG8833_RECORD_FRAME_HEADER_SIZE + rec[2] + 2;                                           /* skip the record */
+        }
+        else if (a_amg8833_record_find_block(reader->data, reader->len, pos + 1, &pos) == 0)                /* find the next block */
+        {
+            break;                                                                                          /* break */
+        }
+    }
+    *num = n;                                                                                               /* set the block number */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     move the reader to a block
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] offset block header offset from amg8833_record_reader_index
+ * @return    status code
+ *            - 0 success
+ *            - 1 offset is not a block header
+ *            - 2 reader is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_reader_seek(amg8833_record_reader_t *reader, uint32_t offset)
+{
+    if (reader == NULL)                                                                                     /* check reader */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if (a_amg8833_record_is_block(reader->data, reader->len, offset) == 0)                                  /* check block */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    reader->offset = offset;                                                                                /* set offset */
+    reader->valid = 0;                                                                                      /* no previous frame */
+    reader->in_block = 0;                                                                                   /* the block header is read next */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the end of the valid records
+ * @param[in]  *reader pointer to a reader structure
+ * @param[out] *end pointer to an end offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end is NULL
+ *             - 2 reader is NULL
+ * @note       the end is updated while reading, read all frames first to get the file end
+ */
+uint8_t amg8833_record_reader_get_end(amg8833_record_reader_t *reader, uint32_t *end)
+{
+    if (reader == NULL)                                                                                     /* check reader */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if (end == NULL)                                                                                        /* check end */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    
+    *end = reader->end;                                                                                     /* get the end */
+    
+    return 0;                                                                                               /* success return 0 */
+}
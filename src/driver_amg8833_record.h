@@ -0,0 +1,250 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_record.h
+ * @brief     driver amg8833 record header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_RECORD_H
+#define DRIVER_AMG8833_RECORD_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_record_driver amg8833 record driver function
+ * @brief    amg8833 record driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 record format definition
+ * @note  all fields are little endian
+ *        file header:   "AMGR" | version(2) | encoding(2) | block frames(2) | reserved(4) | crc16(2)
+ *        block header:  "BLK0" | block(4) | timestamp(8) | reserved(2) | crc16(2)
+ *        frame record:  tag(1) | sensor(1) | length(1) | status(1) | thermistor(2) | time(4) | payload | crc16(2)
+ *        a block starts every block frames records and the first record of every sensor in a block is a key frame,
+ *        the time of a record is in us since the block timestamp,
+ *        the offsets are 32 bits so a file holds at most 4 GiB and a longer recording goes on in a new file
+ */
+#define AMG8833_RECORD_VERSION                 0x0001        /**< format version */
+#define AMG8833_RECORD_FILE_HEADER_SIZE        16            /**< file header size */
+#define AMG8833_RECORD_BLOCK_HEADER_SIZE       20            /**< block header size */
+#define AMG8833_RECORD_FRAME_HEADER_SIZE       10            /**< frame record header size */
+#define AMG8833_RECORD_MAX_PAYLOAD             96            /**< max frame payload size, a key frame */
+#define AMG8833_RECORD_MAX_FILE_SIZE           0xFFFFFFFFUL  /**< max file size */
+
+/**
+ * @brief amg8833 record max sensor number definition
+ * @note  at most 32
+ */
+#ifndef AMG8833_RECORD_MAX_SENSOR
+    #define AMG8833_RECORD_MAX_SENSOR 16        /**< 16 sensors */
+#endif
+
+/**
+ * @brief amg8833 record encoding enumeration definition
+ */
+typedef enum
+{
+    AMG8833_RECORD_ENCODING_RAW   = 0x00,        /**< every frame is a packed 12 bits key frame, 96 bytes payload */
+    AMG8833_RECORD_ENCODING_DELTA = 0x01,        /**< zigzag difference to the previous frame in nibbles, or a key frame if not smaller */
+    AMG8833_RECORD_ENCODING_XOR   = 0x02,        /**< xor with the previous frame in nibbles, or a key frame if not smaller */
+} amg8833_record_encoding_t;
+
+/**
+ * @brief amg8833 record frame structure definition
+ */
+typedef struct amg8833_record_frame_s
+{
+    uint64_t timestamp;                             /**< timestamp in us */
+    uint8_t sensor;                                 /**< sensor id */
+    uint8_t status;                                 /**< stat register */
+    int16_t thermistor;                             /**< thermistor temperature, 0.0625C per lsb */
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];         /**< pixel registers, see AMG8833_FRAME_PIXEL */
+} amg8833_record_frame_t;
+
+/**
+ * @brief amg8833 record block index structure definition
+ */
+typedef struct amg8833_record_index_s
+{
+    uint64_t timestamp;        /**< block timestamp */
+    uint32_t offset;           /**< block header offset */
+    uint32_t block;            /**< block number */
+} amg8833_record_index_t;
+
+/**
+ * @brief amg8833 record writer structure definition
+ */
+typedef struct amg8833_record_writer_s
+{
+    uint8_t (*write)(void *user, const uint8_t *data, uint32_t len);        /**< append function, return 0 on success */
+    void *user;                                                             /**< append function context */
+    uint64_t block_timestamp;                                               /**< current block timestamp */
+    uint32_t offset;                                                        /**< file size */
+    uint32_t block;                                                         /**< next block number */
+    uint32_t key;                                                           /**< sensors with a key frame in the block */
+    uint16_t block_frames;                                                  /**< records per block */
+    uint16_t frames;                                                        /**< records in the block */
+    uint8_t encoding;                                                       /**< encoding */
+    uint16_t prev[AMG8833_RECORD_MAX_SENSOR][64];                           /**< previous pixels of every sensor */
+} amg8833_record_writer_t;
+
+/**
+ * @brief amg8833 record reader structure definition
+ */
+typedef struct amg8833_record_reader_s
+{
+    const uint8_t *data;                                   /**< file data */
+    uint32_t len;                                          /**< file data length */
+    uint32_t offset;                                       /**< read offset */
+    uint32_t end;                                          /**< end of the last valid record */
+    uint32_t corrupt;                                      /**< skipped corrupt record number */
+    uint64_t block_timestamp;                              /**< current block timestamp */
+    uint32_t valid;                                        /**< sensors with a previous frame */
+    uint8_t in_block;                                      /**< inside a valid block */
+    uint16_t prev[AMG8833_RECORD_MAX_SENSOR][64];          /**< previous pixels of every sensor */
+} amg8833_record_reader_t;
+
+/**
+ * @brief     init the record writer
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] encoding frame encoding
+ * @param[in] block_frames records per block
+ * @param[in] *write pointer to an append function
+ * @param[in] *user pointer to an append function context
+ * @param[in] offset current file size
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 writer is NULL
+ * @note      when offset is 0 the file header is written, else the records are appended after offset,
+ *            to resume after a power loss truncate the file to the end given by amg8833_record_reader_get_end
+ */
+uint8_t amg8833_record_writer_init(amg8833_record_writer_t *writer, amg8833_record_encoding_t encoding, uint16_t block_frames,
+                                   uint8_t (*write)(void *user, const uint8_t *data, uint32_t len), void *user, uint32_t offset);
+
+/**
+ * @brief     append a frame
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *frame pointer to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ *            - 4 sensor is invalid
+ *            - 5 file is full
+ * @note      every record is written with one append call, a record cut by a power loss is dropped by the reader,
+ *            the write fails with 5 and nothing is appended when a block header and a key frame may not fit
+ *            under AMG8833_RECORD_MAX_FILE_SIZE, then the recording goes on with a writer on a new file
+ */
+uint8_t amg8833_record_writer_write(amg8833_record_writer_t *writer, const amg8833_record_frame_t *frame);
+
+/**
+ * @brief     init the record reader
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] *data pointer to the file data
+ * @param[in] len file data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 file header is invalid
+ *            - 2 reader is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_reader_init(amg8833_record_reader_t *reader, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief      read the next frame
+ * @param[in]  *reader pointer to a reader structure
+ * @param[out] *frame pointer to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more frame
+ *             - 2 reader is NULL
+ * @note       a corrupt record is counted and the reader moves on to the next block,
+ *             a record cut at the end of the data ends the reading
+ */
+uint8_t amg8833_record_reader_read(amg8833_record_reader_t *reader, amg8833_record_frame_t *frame);
+
+/**
+ * @brief         build the block index
+ * @param[in]     *reader pointer to a reader structure
+ * @param[out]    *index pointer to an index array
+ * @param[in,out] *num pointer to an index number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 buffer is NULL
+ *                - 2 reader is NULL
+ * @note          num is the array size as input and the block number as output,
+ *                only the record headers are visited and the read position is kept
+ */
+uint8_t amg8833_record_reader_index(amg8833_record_reader_t *reader, amg8833_record_index_t *index, uint32_t *num);
+
+/**
+ * @brief     move the reader to a block
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] offset block header offset from amg8833_record_reader_index
+ * @return    status code
+ *            - 0 success
+ *            - 1 offset is not a block header
+ *            - 2 reader is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_reader_seek(amg8833_record_reader_t *reader, uint32_t offset);
+
+/**
+ * @brief      get the end of the valid records
+ * @param[in]  *reader pointer to a reader structure
+ * @param[out] *end pointer to an end offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end is NULL
+ *             - 2 reader is NULL
+ * @note       the end is updated while reading, read all frames first to get the file end
+ */
+uint8_t amg8833_record_reader_get_end(amg8833_record_reader_t *reader, uint32_t *end);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
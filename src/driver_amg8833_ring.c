@@ -0,0 +1,356 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_ring.c
+ * @brief     driver amg8833 ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_ring.h"
+
+/**
+ * @brief ring index access definition
+ * @note  without the gnu atomics the volatile indexes are fenced by a barrier, so the frame
+ *        written before a store is not moved after it and the frame read after a load is not moved before it
+ */
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+    #define a_amg8833_ring_load(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)            /**< load acquire */
+    #define a_amg8833_ring_store(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)      /**< store release */
+#else
+    #if defined(__CC_ARM)
+        #define a_amg8833_ring_barrier()    __memory_changed()                              /**< armcc compiler barrier */
+    #elif defined(__ICCARM__)
+        #include <intrinsics.h>
+        #define a_amg8833_ring_barrier()    __DMB()                                         /**< iar memory barrier */
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+        #include <stdatomic.h>
+        #define a_amg8833_ring_barrier()    atomic_thread_fence(memory_order_seq_cst)      /**< c11 fence */
+    #else
+        #error "amg8833 ring needs the gnu atomics, c11 atomics or a known compiler barrier"
+    #endif
+
+/**
+ * @brief     load an index with the acquire order
+ * @param[in] *p pointer to an index
+ * @return    index
+ * @note      none
+ */
+static uint32_t a_amg8833_ring_load(volatile uint32_t *p)
+{
+    uint32_t v;
+    
+    v = *p;                                   /* volatile load */
+    a_amg8833_ring_barrier();                 /* later reads stay after the load */
+    
+    return v;                                 /* return the index */
+}
+
+/**
+ * @brief     store an index with the release order
+ * @param[in] *p pointer to an index
+ * @param[in] v index
+ * @note      none
+ */
+static void a_amg8833_ring_store(volatile uint32_t *p, uint32_t v)
+{
+    a_amg8833_ring_barrier();                 /* earlier writes stay before the store */
+    *p = v;                                   /* volatile store */
+}
+#endif
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *frame pointer to a frame storage
+ * @param[in] size frame storage size
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 ring is NULL
+ * @note      size must be a power of two
+ */
+uint8_t amg8833_ring_init(amg8833_ring_t *ring, amg8833_ring_frame_t *frame, uint32_t size)
+{
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if ((frame == NULL) || (size == 0) || ((size & (size - 1)) != 0))                                /* check storage */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    ring->head = 0;                                                                                  /* init head */
+    ring->sequence = 0;                                                                              /* init sequence */
+    ring->dropped = 0;                                                                               /* init dropped */
+    ring->tail = 0;                                                                                  /* init tail */
+    ring->frame = frame;                                                                             /* set storage */
+    ring->mask = size - 1;                                                                           /* set mask */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      acquire a free frame for the producer
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] **frame pointer to a frame pointer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is full
+ *             - 2 ring or frame is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_acquire(amg8833_ring_t *ring, amg8833_ring_frame_t **frame)
+{
+    uint32_t head;
+    
+    if ((ring == NULL) || (frame == NULL))                                                           /* check ring and frame */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    head = ring->head;                                                                               /* only the producer writes head */
+    if ((head - a_amg8833_ring_load(&ring->tail)) > ring->mask)                                      /* check full */
+    {
+        ring->sequence++;                                                                            /* skip the sequence */
+        a_amg8833_ring_store(&ring->dropped, ring->dropped + 1);                                     /* count the dropped frame */
+        
+        return 1;                                                                                    /* return error */
+    }
+    *frame = &ring->frame[head & ring->mask];                                                        /* get the free frame */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     commit the acquired frame to the consumer
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] timestamp frame timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ * @note      none
+ */
+uint8_t amg8833_ring_commit(amg8833_ring_t *ring, uint64_t timestamp)
+{
+    amg8833_ring_frame_t *frame;
+    uint32_t head;
+    
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    head = ring->head;                                                                               /* only the producer writes head */
+    frame = &ring->frame[head & ring->mask];                                                         /* get the acquired frame */
+    frame->timestamp = timestamp;                                                                    /* set timestamp */
+    frame->sequence = ring->sequence;                                                                /* set sequence */
+    ring->sequence++;                                                                                /* sequence++ */
+    a_amg8833_ring_store(&ring->head, head + 1);                                                     /* publish the frame */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     push a frame buffer into the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] timestamp frame timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 ring is NULL
+ * @note      none
+ */
+uint8_t amg8833_ring_push(amg8833_ring_t *ring, const uint8_t *buf, uint64_t timestamp)
+{
+    uint8_t res;
+    amg8833_ring_frame_t *frame;
+    
+    res = amg8833_ring_acquire(ring, &frame);                                                        /* acquire a frame */
+    if (res != 0)                                                                                    /* check result */
+    {
+        return res;                                                                                  /* return error */
+    }
+    memcpy(frame->buf, buf, AMG8833_FRAME_BUFFER_SIZE);                                              /* copy the buffer */
+    
+    return amg8833_ring_commit(ring, timestamp);                                                     /* commit the frame */
+}
+
+/**
+ * @brief      peek the continuous frames for the consumer
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] **frame pointer to a frame pointer
+ * @param[out] *len pointer to a frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_peek(amg8833_ring_t *ring, amg8833_ring_frame_t **frame, uint32_t *len)
+{
+    uint32_t tail;
+    uint32_t count;
+    uint32_t wrap;
+    
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    tail = ring->tail;                                                                               /* only the consumer writes tail */
+    count = a_amg8833_ring_load(&ring->head) - tail;                                                 /* get the frame number */
+    if (count == 0)                                                                                  /* check empty */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    wrap = ring->mask + 1 - (tail & ring->mask);                                                     /* frames before the wrap */
+    *frame = &ring->frame[tail & ring->mask];                                                        /* set the first frame */
+    *len = (count < wrap) ? count : wrap;                                                            /* set the continuous frame number */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     release the peeked frames
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] len released frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 len is over the frame number
+ *            - 2 ring is NULL
+ * @note      none
+ */
+uint8_t amg8833_ring_release(amg8833_ring_t *ring, uint32_t len)
+{
+    uint32_t tail;
+    
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    tail = ring->tail;                                                                               /* only the consumer writes tail */
+    if (len > (a_amg8833_ring_load(&ring->head) - tail))                                             /* check len */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    a_amg8833_ring_store(&ring->tail, tail + len);                                                   /* give back the frames */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief         read frames from the ring
+ * @param[in]     *ring pointer to a ring structure
+ * @param[out]    *frame pointer to a frame array
+ * @param[in,out] *len pointer to a frame number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 ring is empty
+ *                - 2 ring is NULL
+ * @note          none
+ */
+uint8_t amg8833_ring_read(amg8833_ring_t *ring, amg8833_ring_frame_t *frame, uint32_t *len)
+{
+    uint32_t tail;
+    uint32_t count;
+    uint32_t i;
+    
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    tail = ring->tail;                                                                               /* only the consumer writes tail */
+    count = a_amg8833_ring_load(&ring->head) - tail;                                                 /* get the frame number */
+    if (count == 0)                                                                                  /* check empty */
+    {
+        *len = 0;                                                                                    /* no frame */
+        
+        return 1;                                                                                    /* return error */
+    }
+    if (count > *len)                                                                                /* check the array size */
+    {
+        count = *len;                                                                                /* limit the frame number */
+    }
+    for (i = 0; i < count; i++)                                                                      /* copy all frames */
+    {
+        memcpy(&frame[i], &ring->frame[(tail + i) & ring->mask], sizeof(amg8833_ring_frame_t));      /* copy the frame */
+    }
+    a_amg8833_ring_store(&ring->tail, tail + count);                                                 /* give back the frames */
+    *len = count;                                                                                    /* set the read frame number */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the frame number in the ring
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *count pointer to a frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_get_count(amg8833_ring_t *ring, uint32_t *count)
+{
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    *count = a_amg8833_ring_load(&ring->head) - a_amg8833_ring_load(&ring->tail);                    /* get the frame number */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the dropped frame number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_get_dropped(amg8833_ring_t *ring, uint32_t *dropped)
+{
+    if (ring == NULL)                                                                                /* check ring */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    *dropped = a_amg8833_ring_load(&ring->dropped);                                                  /* get the dropped frame number */
+    
+    return 0;                                                                                        /* success return 0 */
+}
@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_ring.h
+ * @brief     driver amg8833 ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_RING_H
+#define DRIVER_AMG8833_RING_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_ring_driver amg8833 ring driver function
+ * @brief    amg8833 ring driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 ring cache line size definition
+ */
+#ifndef AMG8833_RING_CACHE_LINE_SIZE
+    #define AMG8833_RING_CACHE_LINE_SIZE 64        /**< 64 bytes */
+#endif
+
+/**
+ * @brief amg8833 ring alignment definition
+ */
+#if defined(__GNUC__)
+    #define AMG8833_RING_ALIGNED __attribute__((aligned(AMG8833_RING_CACHE_LINE_SIZE)))        /**< cache line aligned */
+#else
+    #define AMG8833_RING_ALIGNED                                                               /**< no alignment */
+#endif
+
+/**
+ * @brief amg8833 ring frame structure definition
+ */
+typedef struct amg8833_ring_frame_s
+{
+    uint64_t timestamp;                           /**< timestamp given by the producer */
+    uint32_t sequence;                            /**< sequence number */
+    uint32_t reserved;                            /**< reserved */
+    uint8_t buf[AMG8833_FRAME_BUFFER_SIZE];       /**< frame buffer */
+} amg8833_ring_frame_t;
+
+/**
+ * @brief amg8833 ring structure definition
+ * @note  the producer and the consumer indexes are kept on their own cache lines
+ */
+typedef struct amg8833_ring_s
+{
+    volatile uint32_t head AMG8833_RING_ALIGNED;            /**< write index, written by the producer */
+    uint32_t sequence;                                      /**< next sequence number */
+    volatile uint32_t dropped;                              /**< dropped frame number */
+    volatile uint32_t tail AMG8833_RING_ALIGNED;            /**< read index, written by the consumer */
+    amg8833_ring_frame_t *frame AMG8833_RING_ALIGNED;       /**< frame storage */
+    uint32_t mask;                                          /**< index mask */
+} amg8833_ring_t;
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *frame pointer to a frame storage
+ * @param[in] size frame storage size
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 ring is NULL
+ * @note      size must be a power of two
+ */
+uint8_t amg8833_ring_init(amg8833_ring_t *ring, amg8833_ring_frame_t *frame, uint32_t size);
+
+/**
+ * @brief      acquire a free frame for the producer
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] **frame pointer to a frame pointer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is full
+ *             - 2 ring or frame is NULL
+ * @note       fill frame->buf and call amg8833_ring_commit,
+ *             when the ring is full the frame is counted as dropped and its sequence number is skipped
+ */
+uint8_t amg8833_ring_acquire(amg8833_ring_t *ring, amg8833_ring_frame_t **frame);
+
+/**
+ * @brief     commit the acquired frame to the consumer
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] timestamp frame timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ * @note      only call it after a successful amg8833_ring_acquire
+ */
+uint8_t amg8833_ring_commit(amg8833_ring_t *ring, uint64_t timestamp);
+
+/**
+ * @brief     push a frame buffer into the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] timestamp frame timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ *            - 2 ring is NULL
+ * @note      none
+ */
+uint8_t amg8833_ring_push(amg8833_ring_t *ring, const uint8_t *buf, uint64_t timestamp);
+
+/**
+ * @brief      peek the continuous frames for the consumer
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] **frame pointer to a frame pointer
+ * @param[out] *len pointer to a frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ *             - 2 ring is NULL
+ * @note       the frames are used in place and given back with amg8833_ring_release
+ */
+uint8_t amg8833_ring_peek(amg8833_ring_t *ring, amg8833_ring_frame_t **frame, uint32_t *len);
+
+/**
+ * @brief     release the peeked frames
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] len released frame number
+ * @return    status code
+ *            - 0 success
+ *            - 1 len is over the frame number
+ *            - 2 ring is NULL
+ * @note      none
+ */
+uint8_t amg8833_ring_release(amg8833_ring_t *ring, uint32_t len);
+
+/**
+ * @brief         read frames from the ring
+ * @param[in]     *ring pointer to a ring structure
+ * @param[out]    *frame pointer to a frame array
+ * @param[in,out] *len pointer to a frame number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 ring is empty
+ *                - 2 ring is NULL
+ * @note          len is the array size as input and the read frame number as output
+ */
+uint8_t amg8833_ring_read(amg8833_ring_t *ring, amg8833_ring_frame_t *frame, uint32_t *len);
+
+/**
+ * @brief      get the frame number in the ring
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *count pointer to a frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_get_count(amg8833_ring_t *ring, uint32_t *count);
+
+/**
+ * @brief      get the dropped frame number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *dropped pointer to a dropped frame number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       none
+ */
+uint8_t amg8833_ring_get_dropped(amg8833_ring_t *ring, uint32_t *dropped);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_upscale.c
+ * @brief     driver amg8833 upscale source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_upscale.h"
+
+/**
+ * @brief simd definition
+ */
+#if !defined(AMG8833_UPSCALE_NO_SIMD) && defined(__SSE2__)
+    #define AMG8833_UPSCALE_SSE2        /**< sse2 path */
+    #include <emmintrin.h>
+#elif !defined(AMG8833_UPSCALE_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define AMG8833_UPSCALE_NEON        /**< neon path */
+    #include <arm_neon.h>
+#endif
+
+/**
+ * @brief 4x weight table definition, [mode - 1][phase][tap] in 1/4096
+ */
+static const int16_t gs_upscale_weight_x4[2][4][4] =
+{
+    {
+        {    0,  1536,  2560,     0},        /**< bilinear t = 5/8 */
+        {    0,   512,  3584,     0},        /**< bilinear t = 7/8 */
+        {    0,  3584,   512,     0},        /**< bilinear t = 1/8 */
+        {    0,  2560,  1536,     0},        /**< bilinear t = 3/8 */
+    },
+    {
+        { -180,  1596,  2980,  -300},        /**< bicubic t = 5/8 */
+        {  -28,   372,  3948,  -196},        /**< bicubic t = 7/8 */
+        { -196,  3948,   372,   -28},        /**< bicubic t = 1/8 */
+        { -300,  2980,  1596,  -180},        /**< bicubic t = 3/8 */
+    },
+};
+
+/**
+ * @brief 8x weight table definition, [mode - 1][phase][tap] in 1/4096
+ */
+static const int16_t gs_upscale_weight_x8[2][8][4] =
+{
+    {
+        {    0,  1792,  2304,     0},        /**< bilinear t = 9/16 */
+        {    0,  1280,  2816,     0},        /**< bilinear t = 11/16 */
+        {    0,   768,  3328,     0},        /**< bilinear t = 13/16 */
+        {    0,   256,  3840,     0},        /**< bilinear t = 15/16 */
+        {    0,  3840,   256,     0},        /**< bilinear t = 1/16 */
+        {    0,  3328,   768,     0},        /**< bilinear t = 3/16 */
+        {    0,  2816,  1280,     0},        /**< bilinear t = 5/16 */
+        {    0,  2304,  1792,     0},        /**< bilinear t = 7/16 */
+    },
+    {
+        { -220,  1950,  2650,  -284},        /**< bicubic t = 9/16 */
+        { -138,  1252,  3284,  -302},        /**< bicubic t = 11/16 */
+        {  -58,   632,  3776,  -254},        /**< bicubic t = 13/16 */
+        {   -8,   158,  4058,  -112},        /**< bicubic t = 15/16 */
+        { -112,  4058,   158,    -8},        /**< bicubic t = 1/16 */
+        { -254,  3776,   632,   -58},        /**< bicubic t = 3/16 */
+        { -302,  3284,  1252,  -138},        /**< bicubic t = 5/16 */
+        { -284,  2650,  1950,  -220},        /**< bicubic t = 7/16 */
+    },
+};
+
+/**
+ * @brief      get the taps of an output pixel
+ * @param[in]  factor upscale factor
+ * @param[in]  o output index
+ * @param[out] *tap pointer to 4 input indexes
+ * @note       the output pixel centers are (o + 0.5) / factor - 0.5 in input pixels, the edges are replicated
+ */
+static void a_amg8833_upscale_tap(uint8_t factor, uint8_t o, uint8_t *tap)
+{
+    int8_t base;
+    int8_t idx;
+    uint8_t k;
+    
+    base = (int8_t)(o / factor);                                                                              /* get the input pixel */
+    if ((o % factor) < (factor / 2))                                                                          /* left half */
+    {
+        base--;                                                                                               /* left neighbour */
+    }
+    for (k = 0; k < 4; k++)                                                                                   /* run 4 times */
+    {
+        idx = (int8_t)(base - 1 + k);                                                                         /* get the tap */
+        if (idx < 0)                                                                                          /* check the left edge */
+        {
+            idx = 0;                                                                                          /* replicate */
+        }
+        if (idx > 7)                                                                                          /* check the right edge */
+        {
+            idx = 7;                                                                                          /* replicate */
+        }
+        tap[k] = (uint8_t)idx;                                                                                /* set the tap */
+    }
+}
+
+/**
+ * @brief      vertical pass of one output row
+ * @param[in]  **row pointer to 4 intermediate rows in 1/8 lsb
+ * @param[in]  *w pointer to 4 weights
+ * @param[out] *out pointer to an output row
+ * @param[in]  width row width
+ * @note       width is a multiple of 8
+ */
+static void a_amg8833_upscale_vertical(const int16_t *row[4], const int16_t *w, int16_t *out, uint8_t width)
+{
+    uint8_t c;
+#if defined(AMG8833_UPSCALE_SSE2)
+    __m128i w01;
+    __m128i w23;
+    __m128i a;
+    __m128i b;
+    __m128i lo;
+    __m128i hi;
+    __m128i round;
+    
+    w01 = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)w[1] << 16) | (uint16_t)w[0]));                       /* weight 0 and 1 */
+    w23 = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)w[3] << 16) | (uint16_t)w[2]));                       /* weight 2 and 3 */
+    round = _mm_set1_epi32(1 << 14);                                                                          /* rounding */
+    for (c = 0; c < width; c += 8)                                                                            /* 8 pixels every time */
+    {
+        a = _mm_loadu_si128((const __m128i *)(row[0] + c));                                                   /* load row 0 */
+        b = _mm_loadu_si128((const __m128i *)(row[1] + c));                                                   /* load row 1 */
+        lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w01);                                                   /* low half of row 0 and 1 */
+        hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w01);                                                   /* high half of row 0 and 1 */
+        a = _mm_loadu_si128((const __m128i *)(row[2] + c));                                                   /* load row 2 */
+        b = _mm_loadu_si128((const __m128i *)(row[3] + c));                                                   /* load row 3 */
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w23));                                /* low half of row 2 and 3 */
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w23));                                /* high half of row 2 and 3 */
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), 15);                                                    /* round to lsb */
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), 15);                                                    /* round to lsb */
+        _mm_storeu_si128((__m128i *)(out + c), _mm_packs_epi32(lo, hi));                                      /* store 8 pixels */
+    }
+#elif defined(AMG8833_UPSCALE_NEON)
+    int16x8_t x;
+    int32x4_t lo;
+    int32x4_t hi;
+    
+    for (c = 0; c < width; c += 8)                                                                            /* 8 pixels every time */
+    {
+        x = vld1q_s16(row[0] + c);                                                                            /* load row 0 */
+        lo = vmull_n_s16(vget_low_s16(x), w[0]);                                                              /* low half of row 0 */
+        hi = vmull_n_s16(vget_high_s16(x), w[0]);                                                             /* high half of row 0 */
+        x = vld1q_s16(row[1] + c);                                                                            /* load row 1 */
+        lo = vmlal_n_s16(lo, vget_low_s16(x), w[1]);                                                          /* low half of row 1 */
+        hi = vmlal_n_s16(hi, vget_high_s16(x), w[1]);                                                         /* high half of row 1 */
+        x = vld1q_s16(row[2] + c);                                                                            /* load row 2 */
+        lo = vmlal_n_s16(lo, vget_low_s16(x), w[2]);                                                          /* low half of row 2 */
+        hi = vmlal_n_s16(hi, vget_high_s16(x), w[2]);                                                         /* high half of row 2 */
+        x = vld1q_s16(row[3] + c);                                                                            /* load row 3 */
+        lo = vmlal_n_s16(lo, vget_low_s16(x), w[3]);                                                          /* low half of row 3 */
+        hi = vmlal_n_s16(hi, vget_high_s16(x), w[3]);                                                         /* high half of row 3 */
+        vst1q_s16(out + c, vcombine_s16(vrshrn_n_s32(lo, 15), vrshrn_n_s32(hi, 15)));                         /* round and store 8 pixels */
+    }
+#else
+    int32_t acc;
+    
+    for (c = 0; c < width; c++)                                                                               /* run width times */
+    {
+        acc = (int32_t)w[0] * row[0][c] + (int32_t)w[1] * row[1][c] +                                         /* weighted sum in 1/32768 lsb */
+              (int32_t)w[2] * row[2][c] + (int32_t)w[3] * row[3][c];                                          /* weighted sum in 1/32768 lsb */
+        out[c] = (int16_t)((acc + (1 << 14)) >> 15);                                                          /* round to lsb */
+    }
+#endif
+}
+
+/**
+ * @brief      upscale a raw frame
+ * @param[in]  **in pointer to a raw temperature frame
+ * @param[in]  mode upscale mode
+ * @param[in]  factor upscale factor
+ * @param[out] *out pointer to an upscaled raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ *             - 2 mode is invalid
+ *             - 3 factor is invalid
+ * @note       none
+ */
+uint8_t amg8833_upscale(const int16_t in[8][8], amg8833_upscale_mode_t mode, amg8833_upscale_factor_t factor, int16_t *out)
+{
+    uint8_t r;
+    uint8_t c;
+    uint8_t f;
+    uint8_t width;
+    uint8_t shift;
+    uint8_t tap[4];
+    int32_t acc;
+    const int16_t *w;
+    const int16_t *row[4];
+    int16_t tmp[8][64];
+    
+    if ((in == NULL) || (out == NULL))                                                                        /* check buffer */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    if (mode > AMG8833_UPSCALE_MODE_BICUBIC)                                                                  /* check mode */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if ((factor != AMG8833_UPSCALE_FACTOR_4) && (factor != AMG8833_UPSCALE_FACTOR_8))                         /* check factor */
+    {
+        return 3;                                                                                             /* return error */
+    }
+    
+    f = (uint8_t)factor;                                                                                      /* get the factor */
+    width = (uint8_t)(8 * f);                                                                                 /* get the width */
+    shift = (f == AMG8833_UPSCALE_FACTOR_4) ? 2 : 3;                                                          /* get the shift */
+    if (mode == AMG8833_UPSCALE_MODE_NEAREST)                                                                 /* nearest */
+    {
+        for (r = 0; r < 8; r++)                                                                               /* run 8 times */
+        {
+            for (c = 0; c < width; c++)                                                                       /* run width times */
+            {
+                out[r * f * width + c] = in[r][c >> shift];                                                   /* copy the pixel */
+            }
+            for (c = 1; c < f; c++)                                                                           /* repeat the row */
+            {
+                memcpy(&out[(r * f + c) * width], &out[r * f * width], sizeof(int16_t) * width);              /* copy the row */
+            }
+        }
+        
+        return 0;                                                                                             /* success return 0 */
+    }
+    
+    for (c = 0; c < width; c++)                                                                               /* horizontal pass */
+    {
+        a_amg8833_upscale_tap(f, c, tap);                                                                     /* get the taps */
+        if (f == AMG8833_UPSCALE_FACTOR_4)                                                                    /* 4x */
+        {
+            w = gs_upscale_weight_x4[mode - 1][c % 4];                                                        /* get the weights */
+        }
+        else
+        {
+            w = gs_upscale_weight_x8[mode - 1][c % 8];                                                        /* get the weights */
+        }
+        for (r = 0; r < 8; r++)                                                                               /* run 8 times */
+        {
+            acc = (int32_t)w[0] * in[r][tap[0]] + (int32_t)w[1] * in[r][tap[1]] +                             /* weighted sum in 1/4096 lsb */
+                  (int32_t)w[2] * in[r][tap[2]] + (int32_t)w[3] * in[r][tap[3]];                              /* weighted sum in 1/4096 lsb */
+            tmp[r][c] = (int16_t)((acc + (1 << 8)) >> 9);                                                     /* keep 1/8 lsb */
+        }
+    }
+    for (r = 0; r < width; r++)                                                                               /* vertical pass */
+    {
+        a_amg8833_upscale_tap(f, r, tap);                                                                     /* get the taps */
+        if (f == AMG8833_UPSCALE_FACTOR_4)                                                                    /* 4x */
+        {
+            w = gs_upscale_weight_x4[mode - 1][r % 4];                                                        /* get the weights */
+        }
+        else
+        {
+            w = gs_upscale_weight_x8[mode - 1][r % 8];                                                        /* get the weights */
+        }
+        row[0] = tmp[tap[0]];                                                                                 /* set row 0 */
+        row[1] = tmp[tap[1]];                                                                                 /* set row 1 */
+        row[2] = tmp[tap[2]];                                                                                 /* set row 2 */
+        row[3] = tmp[tap[3]];                                                                                 /* set row 3 */
+        a_amg8833_upscale_vertical(row, w, &out[r * width], width);                                           /* blend the rows */
+    }
+    
+    return 0;                                                                                                 /* success return 0 */
+}
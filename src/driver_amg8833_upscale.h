@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_amg8833_upscale.h
+ * @brief     driver amg8833 upscale header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_UPSCALE_H
+#define DRIVER_AMG8833_UPSCALE_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_upscale_driver amg8833 upscale driver function
+ * @brief    amg8833 upscale driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief     get the upscaled frame size
+ * @param[in] FACTOR upscale factor
+ * @note      the result is the pixel number of the output buffer
+ */
+#define AMG8833_UPSCALE_SIZE(FACTOR)        (64 * (FACTOR) * (FACTOR))
+
+/**
+ * @brief amg8833 upscale mode enumeration definition
+ */
+typedef enum
+{
+    AMG8833_UPSCALE_MODE_NEAREST  = 0x00,        /**< nearest neighbour */
+    AMG8833_UPSCALE_MODE_BILINEAR = 0x01,        /**< bilinear */
+    AMG8833_UPSCALE_MODE_BICUBIC  = 0x02,        /**< catmull-rom bicubic */
+} amg8833_upscale_mode_t;
+
+/**
+ * @brief amg8833 upscale factor enumeration definition
+ */
+typedef enum
+{
+    AMG8833_UPSCALE_FACTOR_4 = 4,        /**< 32 x 32 output */
+    AMG8833_UPSCALE_FACTOR_8 = 8,        /**< 64 x 64 output */
+} amg8833_upscale_factor_t;
+
+/**
+ * @brief      upscale a raw frame
+ * @param[in]  **in pointer to a raw temperature frame
+ * @param[in]  mode upscale mode
+ * @param[in]  factor upscale factor
+ * @param[out] *out pointer to an upscaled raw temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ *             - 2 mode is invalid
+ *             - 3 factor is invalid
+ * @note       out holds AMG8833_UPSCALE_SIZE(factor) pixels row by row, 0.25C per lsb,
+ *             the input is the raw output of amg8833_read_temperature_array,
+ *             the weights are 12 bits fixed point and the simd paths give the same result as the scalar path
+ */
+uint8_t amg8833_upscale(const int16_t in[8][8], amg8833_upscale_mode_t mode, amg8833_upscale_factor_t factor, int16_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
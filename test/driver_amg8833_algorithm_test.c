@@ -0,0 +1,820 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_algorithm_test.c
+ * @brief     driver amg8833 algorithm test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-01-01
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/01/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_algorithm_test.h"
+#include "driver_amg8833_decode.h"
+#include "driver_amg8833_filter.h"
+#include "driver_amg8833_background.h"
+#include "driver_amg8833_upscale.h"
+#include "driver_amg8833_record.h"
+#include "driver_amg8833_counter.h"
+
+static int16_t gs_raw[8][8];                         /**< raw buffer */
+static amg8833_filter_t gs_filter;                   /**< filter buffer */
+static amg8833_background_t gs_background;           /**< background buffer */
+static int16_t gs_upscale[AMG8833_UPSCALE_SIZE(4)];  /**< upscale buffer */
+static amg8833_record_writer_t gs_writer;            /**< record writer buffer */
+static amg8833_record_reader_t gs_reader;            /**< record reader buffer */
+static amg8833_record_frame_t gs_frame[10];          /**< record frame buffer */
+static amg8833_record_frame_t gs_record_frame;       /**< record read buffer */
+static uint8_t gs_record[2048];                      /**< record file buffer */
+static uint32_t gs_record_len;                       /**< record file length */
+static amg8833_counter_t gs_counter;                 /**< counter buffer */
+static uint8_t gs_decode_buf[3 * AMG8833_FRAME_BUFFER_SIZE];  /**< decode frame buffer */
+static int16_t gs_decode_raw[3 * 64];                /**< decode raw output buffer */
+static int32_t gs_decode_fixed[3 * 64];              /**< decode fixed point output buffer */
+static float gs_decode_float[3 * 64];                /**< decode float output buffer */
+static int16_t gs_decode_expect_raw[3 * 64];         /**< decode raw expected buffer */
+static int32_t gs_decode_expect_fixed[3 * 64];       /**< decode fixed point expected buffer */
+static float gs_decode_expect_float[3 * 64];         /**< decode float expected buffer */
+
+/**
+ * @brief     record append callback
+ * @param[in] *user pointer to a context
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_amg8833_record_write(void *user, const uint8_t *data, uint32_t len)
+{
+    (void)user;
+    
+    if (len > sizeof(gs_record) - gs_record_len)
+    {
+        return 1;
+    }
+    memcpy(&gs_record[gs_record_len], data, len);
+    gs_record_len += len;
+    
+    return 0;
+}
+
+/**
+ * @brief      decode a frame buffer into the expected orientation
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[in]  orientation output orientation
+ * @param[out] *out pointer to 64 pixels
+ * @note       independent of the driver orientation table, written from the identity image
+ */
+static void a_amg8833_decode_reference(const uint8_t *buf, amg8833_orientation_t orientation, int16_t *out)
+{
+    int16_t image[8][8];
+    int16_t v;
+    uint8_t r, c, sr, sc;
+    
+    for (r = 0; r < 8; r++)
+    {
+        for (c = 0; c < 8; c++)
+        {
+            /* identity places pixel_64 at the top left */
+            v = (int16_t)((((uint16_t)buf[(63 - r * 8 - c) * 2 + 1] & 0x0F) << 8) | buf[(63 - r * 8 - c) * 2]);
+            if ((v & 0x800) != 0)
+            {
+                v = (int16_t)(v - 0x1000);
+            }
+            image[r][c] = v;
+        }
+    }
+    for (r = 0; r < 8; r++)
+    {
+        for (c = 0; c < 8; c++)
+        {
+            switch (orientation)
+            {
+                case AMG8833_ORIENTATION_ROTATE_90 :
+                {
+                    sr = (uint8_t)(7 - c);
+                    sc = r;
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_ROTATE_180 :
+                {
+                    sr = (uint8_t)(7 - r);
+                    sc = (uint8_t)(7 - c);
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_ROTATE_270 :
+                {
+                    sr = c;
+                    sc = (uint8_t)(7 - r);
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_MIRROR_HORIZONTAL :
+                {
+                    sr = r;
+                    sc = (uint8_t)(7 - c);
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_MIRROR_VERTICAL :
+                {
+                    sr = (uint8_t)(7 - r);
+                    sc = c;
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_TRANSPOSE :
+                {
+                    sr = c;
+                    sc = r;
+                    
+                    break;
+                }
+                case AMG8833_ORIENTATION_ANTI_TRANSPOSE :
+                {
+                    sr = (uint8_t)(7 - c);
+                    sc = (uint8_t)(7 - r);
+                    
+                    break;
+                }
+                default :
+                {
+                    sr = r;
+                    sc = c;
+                    
+                    break;
+                }
+            }
+            out[r * 8 + c] = image[sr][sc];
+        }
+    }
+}
+
+/**
+ * @brief  check every decode path against the reference bit by bit
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   all orientations and output formats are checked with the extreme pixel codes
+ */
+static uint8_t a_amg8833_decode_check(void)
+{
+    static const int32_t scale[5] = {1, 1, 64, 25, 1};
+    static const uint16_t extreme[8] = {0x800, 0x7FF, 0x000, 0xFFF, 0x001, 0xF800, 0xF7FF, 0x8000};
+    uint32_t seed;
+    uint32_t i;
+    uint8_t path, orientation, format, checked;
+    int16_t pixel;
+    
+    /* thermistor is sign magnitude, the bits above bit 11 are ignored */
+    if ((AMG8833_THERMISTOR_DECODE(0x00, 0x00) != 0) || (AMG8833_THERMISTOR_DECODE(0x07, 0xFF) != 2047) ||
+        (AMG8833_THERMISTOR_DECODE(0x08, 0x00) != 0) || (AMG8833_THERMISTOR_DECODE(0x0F, 0xFF) != -2047) ||
+        (AMG8833_THERMISTOR_DECODE(0xF8, 0x01) != -1) || (AMG8833_THERMISTOR_DECODE(0xF0, 0x01) != 1))
+    {
+        amg8833_interface_debug_print("amg8833: thermistor decode check failed.\n");
+        
+        return 1;
+    }
+    
+    /* extremes in the first frame, pseudo random codes with junk in the upper nibble after */
+    seed = 0x12345678U;
+    for (i = 0; i < 3 * 64; i++)
+    {
+        uint16_t code;
+        
+        seed = seed * 1664525U + 1013904223U;
+        code = (i < 64) ? extreme[i % 8] : (uint16_t)(seed >> 16);
+        gs_decode_buf[i * 2 + 0] = (uint8_t)(code & 0xFF);
+        gs_decode_buf[i * 2 + 1] = (uint8_t)(code >> 8);
+    }
+    
+    checked = 0;
+    for (path = AMG8833_DECODE_PATH_SCALAR; path <= AMG8833_DECODE_PATH_NEON; path++)
+    {
+        if (amg8833_decode_set_path((amg8833_decode_path_t)path) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: decode path %d is not supported.\n", path);
+            
+            continue;
+        }
+        for (orientation = 0; orientation < 8; orientation++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                a_amg8833_decode_reference(&gs_decode_buf[i * AMG8833_FRAME_BUFFER_SIZE],
+                                           (amg8833_orientation_t)orientation, &gs_decode_expect_raw[i * 64]);
+            }
+            for (format = AMG8833_DECODE_FORMAT_RAW; format <= AMG8833_DECODE_FORMAT_FLOAT; format++)
+            {
+                void *out;
+                
+                if (format == AMG8833_DECODE_FORMAT_RAW)
+                {
+                    out = gs_decode_raw;
+                    memset(gs_decode_raw, 0xA5, sizeof(gs_decode_raw));
+                }
+                else if (format == AMG8833_DECODE_FORMAT_FLOAT)
+                {
+                    out = gs_decode_float;
+                    memset(gs_decode_float, 0xA5, sizeof(gs_decode_float));
+                }
+                else
+                {
+                    out = gs_decode_fixed;
+                    memset(gs_decode_fixed, 0xA5, sizeof(gs_decode_fixed));
+                }
+                if (amg8833_decode_frames(gs_decode_buf, 3, (amg8833_orientation_t)orientation,
+                                          (amg8833_decode_format_t)format, out) != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: decode frames failed.\n");
+                    (void)amg8833_decode_set_path(AMG8833_DECODE_PATH_AUTO);
+                    
+                    return 1;
+                }
+                for (i = 0; i < 3 * 64; i++)
+                {
+                    pixel = gs_decode_expect_raw[i];
+                    gs_decode_expect_fixed[i] = (int32_t)pixel * scale[format];
+                    gs_decode_expect_float[i] = (float)pixel * 0.25f;
+                }
+                if (((format == AMG8833_DECODE_FORMAT_RAW) &&
+                     (memcmp(gs_decode_raw, gs_decode_expect_raw, sizeof(gs_decode_raw)) != 0)) ||
+                    ((format == AMG8833_DECODE_FORMAT_FLOAT) &&
+                     (memcmp(gs_decode_float, gs_decode_expect_float, sizeof(gs_decode_float)) != 0)) ||
+                    ((format != AMG8833_DECODE_FORMAT_RAW) && (format != AMG8833_DECODE_FORMAT_FLOAT) &&
+                     (memcmp(gs_decode_fixed, gs_decode_expect_fixed, sizeof(gs_decode_fixed)) != 0)))
+                {
+                    amg8833_interface_debug_print("amg8833: decode path %d orientation %d format %d check failed.\n",
+                                                  path, orientation, format);
+                    (void)amg8833_decode_set_path(AMG8833_DECODE_PATH_AUTO);
+                    
+                    return 1;
+                }
+            }
+        }
+        checked++;
+    }
+    (void)amg8833_decode_set_path(AMG8833_DECODE_PATH_AUTO);
+    if (checked == 0)
+    {
+        amg8833_interface_debug_print("amg8833: no decode path checked.\n");
+        
+        return 1;
+    }
+    
+    /* bad parameters */
+    if ((amg8833_decode_frames(gs_decode_buf, 1, (amg8833_orientation_t)8, AMG8833_DECODE_FORMAT_RAW, gs_decode_raw) != 4) ||
+        (amg8833_decode_frames(gs_decode_buf, 1, AMG8833_ORIENTATION_IDENTITY, (amg8833_decode_format_t)5, gs_decode_raw) != 4) ||
+        (amg8833_decode_get_path(NULL) != 4))
+    {
+        amg8833_interface_debug_print("amg8833: decode bad parameter check failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the filter step response
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the even pixels step up and the odd pixels step down, the response must be symmetric
+ */
+static uint8_t a_amg8833_filter_check(void)
+{
+    static const uint8_t mode[3] = {AMG8833_FILTER_MODE_IIR, AMG8833_FILTER_MODE_BOX, AMG8833_FILTER_MODE_MEDIAN3};
+    static const uint8_t param[3] = {2, 4, 0};
+    static const int16_t input[3][6] = {{0, 100, 100, 100, 100, 100},
+                                        {0, 100, 100, 100, 100, 100},
+                                        {0, 0, 1000, 0, 100, 100}};
+    static const int16_t expect[3][6] = {{0, 25, 44, 58, 68, 76},
+                                         {0, 50, 67, 75, 100, 100},
+                                         {0, 0, 0, 0, 100, 100}};
+    uint32_t i, j, k;
+    int16_t sign;
+    
+    for (i = 0; i < 3; i++)
+    {
+        if (amg8833_filter_init(&gs_filter, (amg8833_filter_mode_t)mode[i], param[i]) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: filter init failed.\n");
+            
+            return 1;
+        }
+        for (j = 0; j < 6; j++)
+        {
+            for (k = 0; k < 64; k++)
+            {
+                sign = ((k & 1) != 0) ? -1 : 1;
+                gs_raw[k / 8][k % 8] = (int16_t)(sign * input[i][j]);
+            }
+            if (amg8833_filter_update(&gs_filter, (const int16_t (*)[8])gs_raw, gs_raw) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: filter update failed.\n");
+                
+                return 1;
+            }
+            for (k = 0; k < 64; k++)
+            {
+                sign = ((k & 1) != 0) ? -1 : 1;
+                if (gs_raw[k / 8][k % 8] != sign * expect[i][j])
+                {
+                    amg8833_interface_debug_print("amg8833: filter mode %d frame %d is %d, expect %d.\n",
+                                                  mode[i], j, gs_raw[k / 8][k % 8], sign * expect[i][j]);
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the upscale corners and interpolated points
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the input is the plane 100 + 32 * row + 64 * col, bilinear and bicubic must reproduce it
+ *         inside the frame, the bicubic corners overshoot because the edges are replicated
+ */
+static uint8_t a_amg8833_upscale_check(void)
+{
+    static const uint8_t point[4][2] = {{0, 0}, {31, 31}, {14, 14}, {16, 16}};
+    static const int16_t expect[3][4] = {{100, 772, 388, 484},
+                                         {100, 772, 400, 448},
+                                         { 93, 779, 400, 448}};
+    uint32_t i, j;
+    int16_t value;
+    
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            gs_raw[i][j] = (int16_t)(100 + 32 * i + 64 * j);
+        }
+    }
+    for (i = 0; i < 3; i++)
+    {
+        if (amg8833_upscale((const int16_t (*)[8])gs_raw, (amg8833_upscale_mode_t)i,
+                            AMG8833_UPSCALE_FACTOR_4, gs_upscale) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: upscale failed.\n");
+            
+            return 1;
+        }
+        for (j = 0; j < 4; j++)
+        {
+            value = gs_upscale[point[j][0] * 32 + point[j][1]];
+            if (value != expect[i][j])
+            {
+                amg8833_interface_debug_print("amg8833: upscale mode %d at (%d, %d) is %d, expect %d.\n",
+                                              i, point[j][0], point[j][1], value, expect[i][j]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the background model with a synthetic step scene
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   a 2x2 warm object appears after learning, it must be the exact foreground mask
+ *         and must fade into the background after a while
+ */
+static uint8_t a_amg8833_background_check(void)
+{
+    uint64_t object;
+    uint64_t mask;
+    uint32_t i, j, frame;
+    
+    object = ((uint64_t)0x3 << (2 * 8 + 4)) | ((uint64_t)0x3 << (3 * 8 + 4));
+    if (amg8833_background_init(&gs_background, 2, 3, 8) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: background init failed.\n");
+        
+        return 1;
+    }
+    for (frame = 0; frame < 400; frame++)
+    {
+        for (i = 0; i < 64; i++)
+        {
+            /* 22C with +/-1 lsb noise, the object is 30C */
+            j = (frame >= 8) ? (uint32_t)((object >> i) & 0x01) : 0;
+            gs_raw[i / 8][i % 8] = (int16_t)(((j != 0) ? 120 : 88) + (int32_t)((frame + i * 7) % 3) - 1);
+        }
+        if (amg8833_background_update(&gs_background, (const int16_t (*)[8])gs_raw, &mask) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: background update failed.\n");
+            
+            return 1;
+        }
+        if ((frame < 8) && (mask != 0))
+        {
+            amg8833_interface_debug_print("amg8833: background mask is not 0 while learning.\n");
+            
+            return 1;
+        }
+        if ((frame >= 8) && (frame < 8 + 32) && (mask != object))
+        {
+            amg8833_interface_debug_print("amg8833: background frame %d mask is 0x%08X%08X.\n", frame,
+                                          (uint32_t)(mask >> 32), (uint32_t)(mask & 0xFFFFFFFFU));
+            
+            return 1;
+        }
+        if ((mask & ~object) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: background frame %d has a false foreground.\n", frame);
+            
+            return 1;
+        }
+        if ((frame >= 8 + 32) && (mask == 0))
+        {
+            break;
+        }
+    }
+    if (frame == 400)
+    {
+        amg8833_interface_debug_print("amg8833: background never absorbs the still object.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: still object absorbed after %d frames.\n", frame - 8);
+    
+    return 0;
+}
+
+/**
+ * @brief  check the background convergence at large shifts
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   a uniform 20C scene steps by +1C, -1C and +8C, the mean must reach the input
+ *         from both sides and the warm step must leave the foreground
+ */
+static uint8_t a_amg8833_background_converge_check(void)
+{
+    static const uint8_t shift[2] = {12, 15};
+    static const int16_t step[3] = {4, -4, 32};
+    uint64_t mask;
+    uint32_t i, j, k, frame;
+    
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            if (amg8833_background_init(&gs_background, shift[i], 3, 8) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: background init failed.\n");
+                
+                return 1;
+            }
+            for (frame = 0; frame < 20000; frame++)
+            {
+                for (k = 0; k < 64; k++)
+                {
+                    gs_raw[k / 8][k % 8] = (int16_t)((frame < 8) ? 80 : (80 + step[j]));
+                }
+                if (amg8833_background_update(&gs_background, (const int16_t (*)[8])gs_raw, &mask) != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: background update failed.\n");
+                    
+                    return 1;
+                }
+            }
+            (void)amg8833_background_get_mean(&gs_background, gs_raw);
+            if ((mask != 0) || (gs_raw[0][0] != 80 + step[j]) || (gs_raw[7][7] != 80 + step[j]))
+            {
+                amg8833_interface_debug_print("amg8833: background shift %d step %d mean is %d, expect %d.\n",
+                                              shift[i], step[j], gs_raw[0][0], 80 + step[j]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the counter with synthetic blob tracks
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   a 2x2 warm blob walks the rows, the dead band is row 3.0 - 4.0,
+ *         -1 is an empty frame and -2 ends the scene
+ */
+static uint8_t a_amg8833_counter_check(void)
+{
+    static const int8_t scene[] =
+    {
+        0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1,                   /* in */
+        6, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -1,                   /* out */
+        3, 2, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1,                /* born in the band, out side origin, in */
+        3, 4, 5, 6, -1, -1, -1, -1, -1, -1,                            /* born in the band, leaves, not counted */
+        1, 2, 3, 4, 5, 4, 3, 2, 1, -1, -1, -1, -1, -1, -1,             /* in and back out */
+        -2,
+    };
+    amg8833_counter_config_t config;
+    uint32_t i, frame;
+    uint32_t in, out;
+    int8_t row;
+    
+    (void)amg8833_counter_get_default_config(&config);
+    config.learn = 8;
+    if (amg8833_counter_init(&gs_counter, &config) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: counter init failed.\n");
+        
+        return 1;
+    }
+    if (amg8833_counter_get_count(&gs_counter, NULL, &out) != 1)
+    {
+        amg8833_interface_debug_print("amg8833: counter get count accepts NULL.\n");
+        
+        return 1;
+    }
+    for (frame = 0; ; frame++)
+    {
+        row = (frame < config.learn) ? -1 : scene[frame - config.learn];
+        if (row == -2)
+        {
+            break;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(88 + (int32_t)((frame + i * 7) % 3) - 1);
+            if ((row >= 0) && ((int8_t)(i / 8) >= row) && ((int8_t)(i / 8) <= row + 1) &&
+                ((i % 8) >= 2) && ((i % 8) <= 3))
+            {
+                gs_raw[i / 8][i % 8] = 120;
+            }
+        }
+        if (amg8833_counter_update(&gs_counter, (const int16_t (*)[8])gs_raw) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: counter update failed.\n");
+            
+            return 1;
+        }
+    }
+    if (amg8833_counter_get_count(&gs_counter, &in, &out) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: counter get count failed.\n");
+        
+        return 1;
+    }
+    if ((in != 3) || (out != 2))
+    {
+        amg8833_interface_debug_print("amg8833: counter in %d out %d, expect in 3 out 2.\n", in, out);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the record key frame fallback and the block index
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   frame 2 is noise, its delta is larger than a 96 bytes key frame and must be written as a key frame,
+ *         then the length of a record in block 1 is corrupted and the index must still find every block,
+ *         at last a writer near 4 GiB must fail with 5 before the offset wraps
+ */
+static uint8_t a_amg8833_record_check(void)
+{
+    amg8833_record_index_t index[4];
+    uint32_t seed;
+    uint32_t start;
+    uint32_t block1;
+    uint32_t num;
+    uint32_t i, j;
+    uint16_t v;
+    uint8_t res;
+    
+    gs_record_len = 0;
+    if (amg8833_record_writer_init(&gs_writer, AMG8833_RECORD_ENCODING_DELTA, 4, a_amg8833_record_write, NULL, 0) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: record writer init failed.\n");
+        
+        return 1;
+    }
+    seed = 1;
+    block1 = 0;
+    for (i = 0; i < 10; i++)
+    {
+        for (j = 0; j < 64; j++)
+        {
+            seed = seed * 1103515245U + 12345U;
+            v = (i == 2) ? (uint16_t)((seed >> 16) & 0xFFF) : (uint16_t)(88 + ((i + j) % 4));
+            gs_frame[i].buf[j * 2 + 0] = (uint8_t)(v & 0xFF);
+            gs_frame[i].buf[j * 2 + 1] = (uint8_t)(v >> 8);
+        }
+        gs_frame[i].timestamp = (uint64_t)i * 100000;
+        gs_frame[i].sensor = 0;
+        gs_frame[i].status = 0;
+        gs_frame[i].thermistor = 0;
+        if (i == 4)
+        {
+            block1 = gs_record_len + AMG8833_RECORD_BLOCK_HEADER_SIZE;
+        }
+        start = gs_record_len;
+        if (amg8833_record_writer_write(&gs_writer, &gs_frame[i]) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: record writer write failed.\n");
+            
+            return 1;
+        }
+        if ((i == 2) && (gs_record_len - start != AMG8833_RECORD_FRAME_HEADER_SIZE + 96 + 2))
+        {
+            amg8833_interface_debug_print("amg8833: noise frame takes %d bytes, expect a key frame.\n", gs_record_len - start);
+            
+            return 1;
+        }
+        if ((i == 1) && (gs_record_len - start >= AMG8833_RECORD_FRAME_HEADER_SIZE + 96 + 2))
+        {
+            amg8833_interface_debug_print("amg8833: small change takes %d bytes, expect a delta frame.\n", gs_record_len - start);
+            
+            return 1;
+        }
+    }
+    if (amg8833_record_reader_init(&gs_reader, gs_record, gs_record_len) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: record reader init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 10; i++)
+    {
+        if ((amg8833_record_reader_read(&gs_reader, &gs_record_frame) != 0) ||
+            (memcmp(gs_record_frame.buf, gs_frame[i].buf, AMG8833_FRAME_BUFFER_SIZE) != 0) ||
+            (gs_record_frame.timestamp != gs_frame[i].timestamp))
+        {
+            amg8833_interface_debug_print("amg8833: record frame %d mismatch.\n", i);
+            
+            return 1;
+        }
+    }
+    
+    /* a corrupt length must not steer the index past the next block */
+    gs_record[block1 + 2] = 0xFF;
+    num = 4;
+    if ((amg8833_record_reader_init(&gs_reader, gs_record, gs_record_len) != 0) ||
+        (amg8833_record_reader_index(&gs_reader, index, &num) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: record reader index failed.\n");
+        
+        return 1;
+    }
+    if ((num != 3) || (index[0].timestamp != 0) || (index[1].timestamp != 400000) || (index[2].timestamp != 800000))
+    {
+        amg8833_interface_debug_print("amg8833: record index found %d blocks, expect 3.\n", num);
+        
+        return 1;
+    }
+    for (i = 0; amg8833_record_reader_read(&gs_reader, &gs_record_frame) == 0; i++)
+    {
+    }
+    if ((i != 6) || (gs_reader.corrupt != 1))
+    {
+        amg8833_interface_debug_print("amg8833: record read %d frames and %d corrupt records, expect 6 and 1.\n",
+                                      i, gs_reader.corrupt);
+        
+        return 1;
+    }
+    
+    /* the file stops before the 32 bits offset wraps */
+    if (amg8833_record_writer_init(&gs_writer, AMG8833_RECORD_ENCODING_DELTA, 4, a_amg8833_record_write, NULL,
+                                   AMG8833_RECORD_MAX_FILE_SIZE - 512) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: record writer init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 64; i++)
+    {
+        gs_record_len = 0;
+        res = amg8833_record_writer_write(&gs_writer, &gs_frame[2]);
+        if (res != 0)
+        {
+            break;
+        }
+    }
+    if ((res != 5) || (gs_record_len != 0) || (i < 3) || (gs_writer.offset < AMG8833_RECORD_MAX_FILE_SIZE - 512))
+    {
+        amg8833_interface_debug_print("amg8833: record writer returned %d at offset 0x%08X, expect 5 before 4 GiB.\n",
+                                      res, gs_writer.offset);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  algorithm test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the host side modules are checked with synthetic frames and need no sensor
+ */
+uint8_t amg8833_algorithm_test(void)
+{
+    /* start algorithm test */
+    amg8833_interface_debug_print("amg8833: start algorithm test.\n");
+    
+    /* batch decode test */
+    amg8833_interface_debug_print("amg8833: batch decode test.\n");
+    if (a_amg8833_decode_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: decode check passed.\n");
+    
+    /* temporal filter test */
+    amg8833_interface_debug_print("amg8833: temporal filter test.\n");
+    if (a_amg8833_filter_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: filter step response check passed.\n");
+    
+    /* background model test */
+    amg8833_interface_debug_print("amg8833: background model test.\n");
+    if (a_amg8833_background_check() != 0)
+    {
+        return 1;
+    }
+    if (a_amg8833_background_converge_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: background check passed.\n");
+    
+    /* counter test */
+    amg8833_interface_debug_print("amg8833: counter test.\n");
+    if (a_amg8833_counter_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: counter check passed.\n");
+    
+    /* upscale test */
+    amg8833_interface_debug_print("amg8833: upscale test.\n");
+    if (a_amg8833_upscale_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: upscale check passed.\n");
+    
+    /* record test */
+    amg8833_interface_debug_print("amg8833: record test.\n");
+    if (a_amg8833_record_check() != 0)
+    {
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: record check passed.\n");
+    
+    /* finish algorithm test */
+    amg8833_interface_debug_print("amg8833: finish algorithm test.\n");
+    
+    return 0;
+}
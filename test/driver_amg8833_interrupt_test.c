@@ -35,8 +35,12 @@
  */
 
 #include "driver_amg8833_interrupt_test.h"
+#include "driver_amg8833_blob.h"
 
-static amg8833_handle_t gs_handle;        /**< amg8833 handle */
+static amg8833_handle_t gs_handle;                /**< amg8833 handle */
+static int16_t gs_raw[8][8];                      /**< raw buffer */
+static float gs_temp[8][8];                       /**< temperature buffer */
+static amg8833_blob_t gs_blob[AMG8833_BLOB_MAX];  /**< blob buffer */
 
 /**
  * @brief  interrupt test irq callback
@@ -279,6 +283,63 @@ uint8_t amg8833_interrupt_test(amg8833_address_t addr_pin,
         amg8833_interface_delay_ms(1000);
     }
     
+    /* blob test */
+    amg8833_interface_debug_print("amg8833: blob test.\n");
+    res = amg8833_interrupt_level_convert_to_register(&gs_handle, low_level, (int16_t *)&level);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: interrupt level convert to register failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    for (i = 0; i < times; i++)
+    {
+        uint8_t table[8][1];
+        uint64_t mask;
+        uint8_t num;
+        uint8_t j;
+        
+        /* get the interrupt table and the frame */
+        res = amg8833_get_interrupt_table(&gs_handle, table);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: get interrupt table failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        res = amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        
+        /* extract the blobs */
+        (void)amg8833_blob_mask_from_table((const uint8_t (*)[1])table, &mask);
+        num = AMG8833_BLOB_MAX;
+        res = amg8833_blob_extract(mask, (const int16_t (*)[8])gs_raw, level, gs_blob, &num);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: blob extract failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        amg8833_interface_debug_print("amg8833: found %d blob(s).\n", num);
+        for (j = 0; j < num; j++)
+        {
+            amg8833_interface_debug_print("amg8833: blob %d size %d at row %0.2f col %0.2f.\n", j, gs_blob[j].size,
+                                          (float)gs_blob[j].wy / 256.0f, (float)gs_blob[j].wx / 256.0f);
+        }
+        
+        /* delay 1000 ms */
+        amg8833_interface_delay_ms(1000);
+    }
+    
     /* finish interrupt test */
     amg8833_interface_debug_print("amg8833: finish interrupt test.\n");
     (void)amg8833_deinit(&gs_handle);
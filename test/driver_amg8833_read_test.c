@@ -36,9 +36,12 @@
 
 #include "driver_amg8833_read_test.h"
 
-static amg8833_handle_t gs_handle;        /**< amg8833 handle */
-static int16_t gs_raw[8][8];              /**< raw buffer */
-static float gs_temp[8][8];               /**< temperature buffer */
+static amg8833_handle_t gs_handle;                   /**< amg8833 handle */
+static int16_t gs_raw[8][8];                         /**< raw buffer */
+static float gs_temp[8][8];                          /**< temperature buffer */
+static amg8833_snapshot_t gs_snapshot;               /**< snapshot buffer */
+static amg8833_acquire_t gs_acquire;                 /**< acquire buffer */
+static uint8_t gs_buf[AMG8833_FRAME_BUFFER_SIZE];    /**< frame buffer */
 
 /**
  * @brief     read test
@@ -54,6 +57,7 @@ uint8_t amg8833_read_test(amg8833_address_t addr_pin, uint32_t times)
     uint32_t i, j, k;
     uint8_t res;
     amg8833_info_t info;
+    amg8833_snapshot_t snapshot;
     
     /* link interface function */
     DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
@@ -191,10 +195,189 @@ uint8_t amg8833_read_test(amg8833_address_t addr_pin, uint32_t times)
             amg8833_interface_debug_print("amg8833: temperature is %0.3fC.\n", temp);
         }
         
+        /* read snapshot */
+        res = amg8833_read_snapshot(&gs_handle, &gs_snapshot);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read snapshot failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        else
+        {
+            amg8833_interface_debug_print("amg8833: snapshot %d status 0x%02X temperature is %0.3fC.\n",
+                                          (int)gs_snapshot.sequence, gs_snapshot.status, (float)gs_snapshot.thermistor * 0.0625f);
+        }
+        
+        /* a snapshot read back to back sees the same frame or the next one */
+        res = amg8833_read_snapshot(&gs_handle, &snapshot);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read snapshot failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        amg8833_interface_debug_print("amg8833: check snapshot sequence %s.\n",
+                                      (snapshot.sequence - gs_snapshot.sequence <= 1) ? "ok" : "error");
+        if (snapshot.sequence - gs_snapshot.sequence > 1)
+        {
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        
         /* delay 1000 ms */
         amg8833_interface_delay_ms(1000);
     }
     
+    /* a new frame taken by an array read advances the snapshot sequence */
+    res = amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_TRUE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    res = amg8833_read_snapshot(&gs_handle, &gs_snapshot);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: read snapshot failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_delay_ms(150);
+    res = amg8833_read_temperature_array_raw(&gs_handle, gs_raw);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    res = amg8833_read_snapshot(&gs_handle, &snapshot);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: read snapshot failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    (void)amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_FALSE);
+    amg8833_interface_debug_print("amg8833: check snapshot sequence after array read %s.\n",
+                                  ((snapshot.sequence - gs_snapshot.sequence >= 1) &&
+                                   (snapshot.sequence - gs_snapshot.sequence <= 2)) ? "ok" : "error");
+    if ((snapshot.sequence - gs_snapshot.sequence < 1) || (snapshot.sequence - gs_snapshot.sequence > 2))
+    {
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    
+    /* acquire test */
+    amg8833_interface_debug_print("amg8833: acquire test.\n");
+    res = amg8833_acquire_init(&gs_handle, &gs_acquire);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: acquire init failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    for (i = 0; i < times; )
+    {
+        uint32_t next;
+        int32_t wait;
+        
+        /* read the next new frame */
+        res = amg8833_acquire_read(&gs_handle, &gs_acquire, amg8833_interface_timestamp_us(), gs_buf, &next);
+        if (res == 0)
+        {
+            amg8833_interface_debug_print("amg8833: new frame center is %0.2fC.\n",
+                                          (float)AMG8833_FRAME_PIXEL_AT(gs_buf, 3, 3) * 0.25f);
+            i++;
+        }
+        else if (res != 4)
+        {
+            amg8833_interface_debug_print("amg8833: acquire read failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        else
+        {
+            /* wait for the next read */
+            wait = (int32_t)(next - amg8833_interface_timestamp_us());
+            if (wait > 0)
+            {
+                amg8833_interface_delay_ms(((uint32_t)wait + 999) / 1000);
+            }
+        }
+    }
+    res = amg8833_acquire_get_statistics(&gs_handle, &gs_acquire, &i, &j, &k);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: acquire get statistics failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: frames %d duplicates %d dropped %d.\n", i, j, k);
+    
+    /* frame change detection test */
+    amg8833_interface_debug_print("amg8833: frame change detection test.\n");
+    res = amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_TRUE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    
+    /* a back to back read within one frame period is not changed, retry when a frame boundary falls between */
+    for (i = 0; i < 3; i++)
+    {
+        res = amg8833_read_temperature_array_raw(&gs_handle, gs_raw);
+        if ((res != 0) && (res != 5))
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        res = amg8833_read_temperature_array_raw(&gs_handle, gs_raw);
+        if ((res != 0) && (res != 5))
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            (void)amg8833_deinit(&gs_handle);
+           
+            return 1;
+        }
+        if (res == 5)
+        {
+            break;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check back to back read not changed %s.\n", (res == 5) ? "ok" : "error");
+    if (res != 5)
+    {
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    res = amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_FALSE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    
     /* finish read test */
     amg8833_interface_debug_print("amg8833: finish read test.\n");
     (void)amg8833_deinit(&gs_handle);
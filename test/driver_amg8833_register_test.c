@@ -51,10 +51,13 @@ uint8_t amg8833_register_test(amg8833_address_t addr_pin)
 {
     uint8_t res;
     int16_t level, level_check;
+    int16_t high, low, hysteresis;
+    int16_t high_check, low_check, hysteresis_check;
     float tmp, tmp_check;
     uint8_t status;
     uint8_t i, j;
     uint8_t table[8][1];
+    uint64_t mask, mask_check;
     amg8833_info_t info;
     amg8833_address_t addr;
     amg8833_mode_t mode;
@@ -491,6 +494,32 @@ uint8_t amg8833_register_test(amg8833_address_t addr_pin)
     }
     amg8833_interface_debug_print("amg8833: check level %s.\n", (level_check == level) ? "ok" : "error");
     
+    /* amg8833_set_interrupt_levels/amg8833_get_interrupt_levels test */
+    amg8833_interface_debug_print("amg8833: amg8833_set_interrupt_levels/amg8833_get_interrupt_levels test.\n");
+    
+    high = rand() % 2048;
+    low = -(rand() % 2048);
+    hysteresis = rand() % 2048;
+    res = amg8833_set_interrupt_levels(&gs_handle, high, low, hysteresis);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set interrupt levels failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: set interrupt levels %d %d %d.\n", high, low, hysteresis);
+    res = amg8833_get_interrupt_levels(&gs_handle, (int16_t *)&high_check, (int16_t *)&low_check, (int16_t *)&hysteresis_check);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get interrupt levels failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check levels %s.\n", ((high_check == high) && (low_check == low) && 
+                                  (hysteresis_check == hysteresis)) ? "ok" : "error");
+    
     /* amg8833_interrupt_level_convert_to_register/amg8833_interrupt_level_convert_to_data test */
     amg8833_interface_debug_print("amg8833: amg8833_interrupt_level_convert_to_register/amg8833_interrupt_level_convert_to_data test.\n");
     
@@ -591,6 +620,139 @@ uint8_t amg8833_register_test(amg8833_address_t addr_pin)
         amg8833_interface_debug_print("\n");
     }
     
+    /* amg8833_get_interrupt_mask test */
+    amg8833_interface_debug_print("amg8833: amg8833_get_interrupt_mask test.\n");
+    
+    res = amg8833_get_interrupt_mask(&gs_handle, (uint64_t *)&mask);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get interrupt mask failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    mask_check = 0;
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            mask_check |= (uint64_t)((table[i][0] >> (7 - j)) & 0x01) << (i * 8 + j);
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check mask %s.\n", (mask_check == mask) ? "ok" : "error");
+    
+    /* amg8833_set_register_cache/amg8833_get_register_cache test */
+    amg8833_interface_debug_print("amg8833: amg8833_set_register_cache/amg8833_get_register_cache test.\n");
+    
+    /* enable */
+    res = amg8833_set_register_cache(&gs_handle, AMG8833_BOOL_TRUE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set register cache failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: enable register cache.\n");
+    res = amg8833_get_register_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get register cache failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check register cache %s.\n", (enable == AMG8833_BOOL_TRUE) ? "ok" : "error");
+    res = amg8833_set_frame_rate(&gs_handle, AMG8833_FRAME_RATE_10_FPS);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame rate failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    res = amg8833_get_frame_rate(&gs_handle, &rate);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get frame rate failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    res = amg8833_get_reg(&gs_handle, 0x02, &status, 1);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get reg failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check cached rate %s.\n", ((rate == AMG8833_FRAME_RATE_10_FPS) && 
+                                  ((status & 0x01) == AMG8833_FRAME_RATE_10_FPS)) ? "ok" : "error");
+    
+    /* disable */
+    res = amg8833_set_register_cache(&gs_handle, AMG8833_BOOL_FALSE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set register cache failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: disable register cache.\n");
+    res = amg8833_get_register_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get register cache failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check register cache %s.\n", (enable == AMG8833_BOOL_FALSE) ? "ok" : "error");
+    
+    /* amg8833_set_frame_change_detect/amg8833_get_frame_change_detect test */
+    amg8833_interface_debug_print("amg8833: amg8833_set_frame_change_detect/amg8833_get_frame_change_detect test.\n");
+    
+    /* enable */
+    res = amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_TRUE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: enable frame change detect.\n");
+    res = amg8833_get_frame_change_detect(&gs_handle, &enable);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check frame change detect %s.\n", (enable == AMG8833_BOOL_TRUE) ? "ok" : "error");
+    
+    /* disable */
+    res = amg8833_set_frame_change_detect(&gs_handle, AMG8833_BOOL_FALSE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: disable frame change detect.\n");
+    res = amg8833_get_frame_change_detect(&gs_handle, &enable);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: get frame change detect failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check frame change detect %s.\n", (enable == AMG8833_BOOL_FALSE) ? "ok" : "error");
+    
     /* amg8833_reset test */
     amg8833_interface_debug_print("amg8833: amg8833_reset test.\n");
     